@@ -0,0 +1,338 @@
+// CxxSwizzle
+// Copyright (c) 2013-2015, Piotr Gwiazdowski <gwiazdorrr+github at gmail.com>
+//
+// Measures accuracy of the backend's scalar builtins: each one is swept densely over its
+// typical domain and compared against a long double reference. Reports max and mean error
+// in ULPs (of float), max absolute error, the worst input and throughput for the same inputs.
+// Usage: accuracy_xxx [-n samples] [name filter...]
+
+#if defined(USE_SIMD)
+#include "use_simd.h"
+#else
+#include "use_scalar.h"
+#endif
+
+#include <swizzle/glsl/vector.h>
+#include <cmath>
+#include <cstdlib>
+#include <cstdint>
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <limits>
+#include "timing.h"
+
+#if !defined(USE_SIMD)
+const char* c_backendName = "scalar";
+#elif defined(VC_IMPL_AVX)
+const char* c_backendName = "Vc AVX";
+#elif defined(VC_IMPL_SSE)
+const char* c_backendName = "Vc SSE";
+#else
+const char* c_backendName = "Vc scalar";
+#endif
+
+namespace accuracy
+{
+    #include <swizzle/glsl/vector_functions.h>
+
+    //! Number of inputs in a throughput run.
+    const size_t c_throughputCount = 4096;
+
+    //! Substrings of builtin names to run; empty means "run everything".
+    std::vector<std::string> g_filters;
+    //! Number of inputs each builtin is swept with.
+    size_t g_sampleCount = 1 << 20;
+
+    inline bool matches(const char* name)
+    {
+        if (g_filters.empty())
+        {
+            return true;
+        }
+        for (auto& filter : g_filters)
+        {
+            if (std::string(name).find(filter) != std::string::npos)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    //! Distance between the float closest to x and the next one (away from zero).
+    inline long double ulp(long double x)
+    {
+        float f = std::fabs(static_cast<float>(x));
+        if (std::isinf(f))
+        {
+            f = std::numeric_limits<float>::max();
+        }
+        return static_cast<long double>(std::nextafter(f, std::numeric_limits<float>::infinity())) - f;
+    }
+
+    //! Error statistics of a single builtin.
+    struct error_stats
+    {
+        long double maxUlp;
+        long double sumUlp;
+        //! Ulps are misleading where results cancel out to ~0 (e.g. mod), hence absolute error too.
+        long double maxAbs;
+        uint64_t count;
+        //! Results that are NaN/infinite while the reference is not (or vice versa).
+        uint64_t nonFiniteMismatches;
+        float worstA;
+        float worstB;
+
+        error_stats()
+            : maxUlp(0)
+            , sumUlp(0)
+            , maxAbs(0)
+            , count(0)
+            , nonFiniteMismatches(0)
+            , worstA(0)
+            , worstB(0)
+        {}
+
+        void add(float result, long double reference, float a, float b)
+        {
+            bool resultFinite = std::isfinite(result);
+            bool referenceFinite = std::isfinite(static_cast<float>(reference));
+            if (!resultFinite || !referenceFinite)
+            {
+                bool same = std::isnan(result) ? std::isnan(reference) : (result == static_cast<float>(reference));
+                if (!same)
+                {
+                    ++nonFiniteMismatches;
+                }
+                return;
+            }
+
+            long double absError = std::fabs(result - reference);
+            maxAbs = std::max(maxAbs, absError);
+            long double error = absError / ulp(reference);
+            if (error > maxUlp)
+            {
+                maxUlp = error;
+                worstA = a;
+                worstB = b;
+            }
+            sumUlp += error;
+            ++count;
+        }
+    };
+
+    //! An aligned buffer of floats, a multiple of scalar_count long.
+    class float_buffer
+    {
+    public:
+        explicit float_buffer(size_t size)
+            : m_size((size + scalar_count - 1) / scalar_count * scalar_count)
+            , m_storage(m_size + float_entries_align / sizeof(float))
+        {
+            auto value = reinterpret_cast<uintptr_t>(m_storage.data());
+            m_data = reinterpret_cast<float*>((value + float_entries_align - 1) & ~(uintptr_t)(float_entries_align - 1));
+        }
+
+        float* data()
+        {
+            return m_data;
+        }
+
+        size_t size() const
+        {
+            return m_size;
+        }
+
+        float& operator[](size_t i)
+        {
+            return m_data[i];
+        }
+
+    private:
+        size_t m_size;
+        std::vector<float> m_storage;
+        float* m_data;
+    };
+
+    inline float_type load(const float* data)
+    {
+        raw_float_type raw;
+        load_aligned(raw, data);
+        return float_type(raw);
+    }
+
+    inline void store(const float_type& value, float* data)
+    {
+        raw_float_type raw = static_cast<raw_float_type>(value);
+        store_aligned(raw, data);
+    }
+
+    //! Evaluates func for each scalar_count inputs.
+    template <class Func>
+    void evaluate(float_buffer& a, float_buffer& b, float_buffer& result, Func func)
+    {
+        for (size_t i = 0; i < result.size(); i += scalar_count)
+        {
+            store(func(load(a.data() + i), load(b.data() + i)), result.data() + i);
+        }
+    }
+
+    //! Fills the buffer with evenly spaced values from [lo; hi] or, if shuffle is set, with the
+    //! same values in pseudo-random order (so that 2-argument functions get all combinations).
+    inline void sweep(float_buffer& buffer, size_t offset, size_t count, float lo, float hi, bool shuffle)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            // golden ratio sequence
+            double t = shuffle ? std::fmod((offset + i) * 0.6180339887498949, 1.0) : (offset + i) / double(g_sampleCount - 1);
+            buffer[i] = static_cast<float>(lo + (hi - lo) * t);
+        }
+    }
+
+    template <class Func, class RefFunc>
+    void run(const char* name, float loA, float hiA, float loB, float hiB, Func func, RefFunc reference)
+    {
+        if (!matches(name))
+        {
+            return;
+        }
+
+        bool binary = loB != hiB;
+        const size_t c_chunkSize = 1 << 16;
+        float_buffer a(c_chunkSize), b(c_chunkSize), result(c_chunkSize);
+        error_stats stats;
+
+        for (size_t offset = 0; offset < g_sampleCount; offset += c_chunkSize)
+        {
+            size_t count = std::min(c_chunkSize, g_sampleCount - offset);
+            sweep(a, offset, count, loA, hiA, false);
+            sweep(b, offset, count, loB, hiB, true);
+            // padding, if any, repeats the last input
+            for (size_t i = count; i < a.size(); ++i)
+            {
+                a[i] = a[count - 1];
+                b[i] = b[count - 1];
+            }
+
+            evaluate(a, b, result, func);
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                stats.add(result[i], reference(static_cast<long double>(a[i]), static_cast<long double>(b[i])), a[i], b[i]);
+            }
+        }
+
+        // throughput, using inputs of the last chunk
+        float_buffer ta(c_throughputCount), tb(c_throughputCount), tresult(c_throughputCount);
+        for (size_t i = 0; i < ta.size(); ++i)
+        {
+            ta[i] = a[i % a.size()];
+            tb[i] = b[i % b.size()];
+        }
+        double ns = measure_ns([&](size_t iterations) -> void
+        {
+            for (size_t i = 0; i < iterations; ++i)
+            {
+                escape(ta.data());
+                escape(tb.data());
+                evaluate(ta, tb, tresult, func);
+                escape(tresult.data());
+            }
+        }) / ta.size();
+
+        std::ostringstream domain;
+        domain << "[" << loA << ";" << hiA << "]";
+        if (binary)
+        {
+            domain << "x[" << loB << ";" << hiB << "]";
+        }
+
+        std::ostringstream worst;
+        worst << std::setprecision(9) << stats.worstA;
+        if (binary)
+        {
+            worst << ", " << stats.worstB;
+        }
+
+        std::cout << std::left << std::setw(14) << name << std::setw(28) << domain.str() << std::right << std::fixed
+            << std::setprecision(2) << std::setw(14) << static_cast<double>(stats.maxUlp)
+            << std::setprecision(4) << std::setw(12) << (stats.count ? static_cast<double>(stats.sumUlp / stats.count) : 0.0)
+            << std::scientific << std::setprecision(2) << std::setw(12) << static_cast<double>(stats.maxAbs) << std::fixed
+            << std::setw(10) << stats.nonFiniteMismatches
+            << std::setprecision(3) << std::setw(10) << ns
+            << "   " << worst.str() << "\n";
+    }
+
+    template <class Func, class RefFunc>
+    void run(const char* name, float lo, float hi, Func func, RefFunc reference)
+    {
+        run(name, lo, hi, 0, 0, func, reference);
+    }
+
+    #define ACCURACY_1(name, lo, hi, ref) run(#name, lo, hi, [](const float_type& a, const float_type&) { return name(a); }, [](long double a, long double) { return ref; })
+    #define ACCURACY_2(name, loA, hiA, loB, hiB, ref) run(#name, loA, hiA, loB, hiB, [](const float_type& a, const float_type& b) { return name(a, b); }, [](long double a, long double b) { return ref; })
+
+    void run_all()
+    {
+        const float c_pi = 3.14159265f;
+
+        ACCURACY_1(sin, -c_pi, c_pi, std::sin(a));
+        ACCURACY_1(sin, -1000.0f, 1000.0f, std::sin(a));
+        ACCURACY_1(cos, -c_pi, c_pi, std::cos(a));
+        ACCURACY_1(cos, -1000.0f, 1000.0f, std::cos(a));
+        ACCURACY_1(asin, -1.0f, 1.0f, std::asin(a));
+        ACCURACY_1(atan, -100.0f, 100.0f, std::atan(a));
+        run("atan(y,x)", -10.0f, 10.0f, -10.0f, 10.0f, [](const float_type& a, const float_type& b) { return atan(a, b); }, [](long double a, long double b) { return std::atan2(a, b); });
+        ACCURACY_2(pow, 0.01f, 100.0f, -4.0f, 4.0f, std::pow(a, b));
+        ACCURACY_1(exp, -80.0f, 80.0f, std::exp(a));
+        ACCURACY_1(log, 0.001f, 1000.0f, std::log(a));
+        ACCURACY_1(log2, 0.001f, 1000.0f, std::log2(a));
+        ACCURACY_1(sqrt, 0.0f, 10000.0f, std::sqrt(a));
+        ACCURACY_1(inversesqrt, 0.0001f, 10000.0f, 1 / std::sqrt(a));
+        ACCURACY_1(fract, -100.0f, 100.0f, a - std::floor(a));
+        ACCURACY_1(radians, -360.0f, 360.0f, a * 3.14159265358979323846264338327950288L / 180);
+        ACCURACY_1(degrees, -6.3f, 6.3f, a * 180 / 3.14159265358979323846264338327950288L);
+        run("smoothstep", -0.5f, 1.5f, [](const float_type& a, const float_type&) { return smoothstep(0.0f, 1.0f, a); },
+            [](long double a, long double) { long double t = std::min(std::max(a, 0.0L), 1.0L); return t * t * (3 - 2 * t); });
+        ACCURACY_2(mod, -100.0f, 100.0f, 0.5f, 10.0f, a - b * std::floor(a / b));
+#if !defined(USE_SIMD)
+        // Vc 0.7 doesn't have these for its vectors
+        ACCURACY_1(tan, -1.5f, 1.5f, std::tan(a));
+        ACCURACY_1(acos, -1.0f, 1.0f, std::acos(a));
+        ACCURACY_1(exp2, -100.0f, 100.0f, std::exp2(a));
+#endif
+    }
+
+    #undef ACCURACY_1
+    #undef ACCURACY_2
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace accuracy;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if (arg == "-n" && i + 1 < argc)
+        {
+            g_sampleCount = std::max<size_t>(2, std::strtoul(argv[++i], nullptr, 10));
+        }
+        else
+        {
+            g_filters.push_back(arg);
+        }
+    }
+
+    std::cout << "backend: " << c_backendName << " (" << scalar_count << " lanes), " << g_sampleCount << " samples per builtin\n\n";
+    std::cout << std::left << std::setw(14) << "builtin" << std::setw(28) << "domain" << std::right
+        << std::setw(14) << "max ulp" << std::setw(12) << "mean ulp" << std::setw(12) << "max abs" << std::setw(10) << "non-fin" << std::setw(10) << "ns/value"
+        << "   worst input\n";
+
+    run_all();
+
+    return 0;
+}
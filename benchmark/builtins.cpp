@@ -0,0 +1,316 @@
+// CxxSwizzle
+// Copyright (c) 2013-2015, Piotr Gwiazdowski <gwiazdorrr+github at gmail.com>
+//
+// Measures cost of every GLSL builtin and of swizzle proxies reads/writes, for
+// float and vec2-vec4 of the backend's float_type. Throughput is measured over a batch
+// of independent inputs, latency by feeding each result back as the next input.
+// Usage: benchmark_xxx [name filter...]
+
+#if defined(USE_SIMD)
+#include "use_simd.h"
+#else
+#include "use_scalar.h"
+#endif
+
+#include <swizzle/glsl/vector.h>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include "timing.h"
+
+typedef swizzle::glsl::vector< float_type, 2 > vec2;
+typedef swizzle::glsl::vector< float_type, 3 > vec3;
+typedef swizzle::glsl::vector< float_type, 4 > vec4;
+
+#if !defined(USE_SIMD)
+const char* c_backendName = "scalar";
+#elif defined(VC_IMPL_AVX)
+const char* c_backendName = "Vc AVX";
+#elif defined(VC_IMPL_SSE)
+const char* c_backendName = "Vc SSE";
+#else
+const char* c_backendName = "Vc scalar";
+#endif
+
+namespace builtins
+{
+    #include <swizzle/glsl/vector_functions.h>
+
+    //! Number of independent inputs a throughput run goes through; enough to hide
+    //! latency of even the slowest builtins.
+    const size_t c_inputCount = 64;
+
+    //! Substrings of builtin names to run; empty means "run everything".
+    std::vector<std::string> g_filters;
+
+    const float_type c_zero = 0.0f;
+    const float_type c_low = 0.25f;
+    const float_type c_high = 0.75f;
+
+    inline bool matches(const char* name)
+    {
+        if (g_filters.empty())
+        {
+            return true;
+        }
+        for (auto& filter : g_filters)
+        {
+            if (std::string(name).find(filter) != std::string::npos)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    //! Fills the value with v (scalars) or v, v+0.01, ... (vectors).
+    template <class T>
+    inline void make_value(T& result, float v)
+    {
+        result = T(v);
+    }
+
+    template <class ScalarType, size_t Size>
+    inline void make_value(swizzle::glsl::vector<ScalarType, Size>& result, float v)
+    {
+        for (size_t i = 0; i < Size; ++i)
+        {
+            result[i] = ScalarType(v + 0.01f * i);
+        }
+    }
+
+    //! Latency runs chain calls with x = result * 0 + next, which keeps the dependency, but also
+    //! keeps arguments in the function's domain. Cost of that is measured separately and subtracted.
+    //! Functions returning a vector of the same type chain directly, scalar results go to the first
+    //! component and anything else (booleans) can't be chained at all.
+    template <class T>
+    inline bool feed_back(T& x, const T& result, const T& next)
+    {
+        x = result * c_zero + next;
+        return true;
+    }
+
+    template <class ScalarType, size_t Size>
+    inline bool feed_back(swizzle::glsl::vector<ScalarType, Size>& x, const ScalarType& result, const swizzle::glsl::vector<ScalarType, Size>& next)
+    {
+        x = next;
+        x[0] = result * c_zero + next[0];
+        return true;
+    }
+
+    template <class T, class TResult>
+    inline bool feed_back(T&, const TResult&, const T&)
+    {
+        return false;
+    }
+
+    template <class T>
+    struct inputs
+    {
+        T a[c_inputCount];
+        T b[c_inputCount];
+
+        inputs()
+        {
+            for (size_t k = 0; k < c_inputCount; ++k)
+            {
+                make_value(a[k], 0.1f + 0.8f * k / c_inputCount);
+                make_value(b[k], 0.9f - 0.8f * k / c_inputCount);
+            }
+        }
+    };
+
+    template <class T, class Func>
+    double measure_throughput(inputs<T>& in, Func func)
+    {
+        return measure_ns([&](size_t iterations) -> void
+        {
+            for (size_t i = 0; i < iterations; ++i)
+            {
+                escape(&in);
+                for (size_t k = 0; k < c_inputCount; ++k)
+                {
+                    do_not_optimize(func(in.a[k], in.b[k]));
+                }
+            }
+        }) / c_inputCount;
+    }
+
+    //! \return Latency in ns or a negative value if the function can't be chained.
+    template <class T, class Func>
+    double measure_latency(inputs<T>& in, Func func)
+    {
+        T x = in.a[0];
+        if (!feed_back(x, func(in.a[0], in.b[0]), in.a[0]))
+        {
+            return -1;
+        }
+
+        return measure_ns([&](size_t iterations) -> void
+        {
+            T x = in.a[0];
+            for (size_t i = 0; i < iterations; ++i)
+            {
+                escape(&in);
+                for (size_t k = 0; k < c_inputCount; ++k)
+                {
+                    feed_back(x, func(x, in.b[k]), in.a[k]);
+                }
+            }
+            do_not_optimize(x);
+        }) / c_inputCount;
+    }
+
+    template <class T>
+    double measure_chain_overhead()
+    {
+        inputs<T> in;
+        return measure_latency(in, [](const T& a, const T&) -> T { return a; });
+    }
+
+    //! Cost of the feed back itself; measured once per type, so that all the builtins of it are
+    //! corrected by the same amount.
+    template <class T>
+    double chain_overhead()
+    {
+        static double s_chainOverhead = measure_chain_overhead<T>();
+        return s_chainOverhead;
+    }
+
+    template <class T, class Func>
+    void run(const char* name, const char* typeName, Func func)
+    {
+        if (!matches(name))
+        {
+            return;
+        }
+
+        inputs<T> in;
+        const double chainOverhead = chain_overhead<T>();
+
+        double throughput = measure_throughput(in, func);
+        double latency = measure_latency(in, func);
+
+        std::cout << std::left << std::setw(20) << name << std::setw(6) << typeName << std::right << std::fixed << std::setprecision(2)
+            << std::setw(12) << throughput << std::setw(12) << throughput / scalar_count;
+        if (latency < 0)
+        {
+            std::cout << std::setw(12) << "-";
+        }
+        else
+        {
+            std::cout << std::setw(12) << std::max(0.0, latency - chainOverhead);
+        }
+        std::cout << "\n";
+    }
+
+    //! Swizzles used in proxy tests, for each vector size.
+    template <class T> struct proxies;
+
+    template <> struct proxies<vec2>
+    {
+        static vec2 read(const vec2& v) { return v.yx; }
+        static vec2 write(const vec2& v, const vec2& w) { vec2 r = w; r.yx = v; return r; }
+    };
+
+    template <> struct proxies<vec3>
+    {
+        static vec3 read(const vec3& v) { return v.zxy; }
+        static vec3 write(const vec3& v, const vec3& w) { vec3 r = w; r.zx = v.xy; return r; }
+    };
+
+    template <> struct proxies<vec4>
+    {
+        static vec4 read(const vec4& v) { return v.wzxy; }
+        static vec4 write(const vec4& v, const vec4& w) { vec4 r = w; r.wy = v.xz; return r; }
+    };
+
+    #define BENCHMARK_1(name) run<T>(#name, typeName, [](const T& a, const T&) { return name(a); })
+    #define BENCHMARK_2(name) run<T>(#name, typeName, [](const T& a, const T& b) { return name(a, b); })
+
+    //! Builtins available for scalars and vectors alike.
+    template <class T>
+    void run_common(const char* typeName)
+    {
+        BENCHMARK_1(radians);
+        BENCHMARK_1(degrees);
+        BENCHMARK_1(sin);
+        BENCHMARK_1(cos);
+        BENCHMARK_1(asin);
+        BENCHMARK_1(atan);
+        run<T>("atan(y,x)", typeName, [](const T& a, const T& b) { return atan(a, b); });
+        BENCHMARK_2(pow);
+        BENCHMARK_1(exp);
+        BENCHMARK_1(log);
+        BENCHMARK_1(log2);
+        BENCHMARK_1(sqrt);
+        BENCHMARK_1(inversesqrt);
+        BENCHMARK_1(abs);
+        BENCHMARK_1(floor);
+        BENCHMARK_1(ceil);
+        BENCHMARK_1(fract);
+        BENCHMARK_2(min);
+        BENCHMARK_2(max);
+        run<T>("clamp", typeName, [](const T& a, const T&) { return clamp(a, c_low, c_high); });
+        run<T>("mix", typeName, [](const T& a, const T& b) { return mix(a, b, c_low); });
+        BENCHMARK_2(step);
+        run<T>("smoothstep", typeName, [](const T& a, const T&) { return smoothstep(c_low, c_high, a); });
+        run<T>("reflect", typeName, [](const T& a, const T& b) { return reflect(a, b); });
+        BENCHMARK_1(length);
+        BENCHMARK_2(distance);
+        BENCHMARK_2(dot);
+        BENCHMARK_1(normalize);
+        BENCHMARK_2(lessThan);
+        BENCHMARK_2(lessThanEqual);
+        BENCHMARK_2(greaterThan);
+        BENCHMARK_2(greaterThanEqual);
+        BENCHMARK_2(equal);
+        BENCHMARK_2(notEqual);
+        BENCHMARK_2(mod);
+#if !defined(USE_SIMD)
+        // Vc 0.7 doesn't have these for its vectors
+        BENCHMARK_1(tan);
+        BENCHMARK_1(acos);
+        BENCHMARK_1(exp2);
+        BENCHMARK_1(sign);
+#endif
+        // for reference: the cheapest possible operations
+        run<T>("operator*", typeName, [](const T& a, const T& b) { return a * b; });
+        run<T>("operator/", typeName, [](const T& a, const T& b) { return a / b; });
+    }
+
+    //! Builtins and proxies specific to vectors.
+    template <class T>
+    void run_vector(const char* typeName)
+    {
+        run_common<T>(typeName);
+        run<T>("proxy read", typeName, [](const T& a, const T&) { return proxies<T>::read(a); });
+        run<T>("proxy write", typeName, [](const T& a, const T& b) { return proxies<T>::write(a, b); });
+    }
+
+    #undef BENCHMARK_1
+    #undef BENCHMARK_2
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace builtins;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        g_filters.push_back(argv[i]);
+    }
+
+    std::cout << "backend: " << c_backendName << " (" << scalar_count << " lanes)\n\n";
+    std::cout << std::left << std::setw(20) << "builtin" << std::setw(6) << "type" << std::right
+        << std::setw(12) << "ns/call" << std::setw(12) << "ns/pixel" << std::setw(12) << "latency ns" << "\n";
+
+    run_common<float_type>("float");
+    run_vector<vec2>("vec2");
+    run_vector<vec3>("vec3");
+    run<vec3>("cross", "vec3", [](const vec3& a, const vec3& b) { return cross(a, b); });
+    run_vector<vec4>("vec4");
+
+    return 0;
+}
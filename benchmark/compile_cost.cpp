@@ -0,0 +1,350 @@
+// CxxSwizzle
+// Copyright (c) 2013-2015, Piotr Gwiazdowski <gwiazdorrr+github at gmail.com>
+//
+// Measures how much compiling code that uses the library costs: synthetic translation units using
+// N vector types and M swizzles are generated and compiled, once per header configuration (a set
+// of macros), reporting the compiler's time and peak memory. Header changes can then be judged by
+// their build cost. Generated code only uses xyzw names, so that any name set configuration works, and
+// no swizzles longer than the configuration's CXXSWIZZLE_MAX_SWIZZLE_LENGTH.
+// POSIX only (fork/wait4).
+// Usage: compile_cost [-c compiler] [-f "flags"] [-n N,...] [-m M,...] [-r runs] [-D MACRO[=value],...]...
+// Each -D adds a configuration; without any, a default set of configurations is measured.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/resource.h>
+#include <sys/time.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#ifndef COMPILE_COST_COMPILER
+#define COMPILE_COST_COMPILER "c++"
+#endif
+
+#ifndef COMPILE_COST_INCLUDE_DIR
+#define COMPILE_COST_INCLUDE_DIR "include"
+#endif
+
+namespace compile_cost
+{
+    //! Scalar and vector sizes the generated types are made of; type i is c_scalarTypes[i / 3] of size 2 + i % 3.
+    const char* const c_scalarTypes[] = { "float", "double", "int" };
+    const size_t c_maxTypeCount = 3 * (sizeof(c_scalarTypes) / sizeof(c_scalarTypes[0]));
+
+    //! Header configurations measured if none is given.
+    const char* const c_defaultConfigurations[] =
+    {
+        "",
+        "CXXSWIZZLE_VECTOR_INOUT_WRAPPER_ENABLED",
+        "CXXSWIZZLE_SWIZZLE_RGBA=0,CXXSWIZZLE_SWIZZLE_STPQ=0",
+        "CXXSWIZZLE_MAX_SWIZZLE_LENGTH=2",
+    };
+
+    //! A header configuration: comma separated macros, as passed to -D.
+    struct configuration
+    {
+        std::string name;
+        std::vector<std::string> macros;
+        //! Longest swizzles the configuration has.
+        size_t maxSwizzleLength;
+
+        explicit configuration(const std::string& definition)
+            : name(definition.empty() ? "(default)" : definition)
+            , maxSwizzleLength(4)
+        {
+            std::istringstream s(definition);
+            std::string macro;
+            while (std::getline(s, macro, ','))
+            {
+                if (!macro.empty())
+                {
+                    macros.push_back(macro);
+                }
+                const std::string c_lengthMacro = "CXXSWIZZLE_MAX_SWIZZLE_LENGTH=";
+                if (macro.compare(0, c_lengthMacro.size(), c_lengthMacro) == 0)
+                {
+                    maxSwizzleLength = std::max<size_t>(1, std::strtoul(macro.c_str() + c_lengthMacro.size(), nullptr, 10));
+                }
+            }
+        }
+    };
+
+    //! Cost of a single compiler run.
+    struct cost
+    {
+        bool succeeded;
+        double wallSeconds;
+        double cpuSeconds;
+        //! Peak resident set size, in megabytes.
+        double peakMegabytes;
+    };
+
+    //! All xyzw swizzles of a vector of the size, of lengths 1 to maxLength, in lexicographic order per length.
+    inline std::vector<std::string> swizzle_names(size_t size, size_t maxLength)
+    {
+        std::vector<std::string> result;
+        for (size_t length = 1; length <= std::min<size_t>(maxLength, 4); ++length)
+        {
+            size_t count = 1;
+            for (size_t i = 0; i < length; ++i)
+            {
+                count *= size;
+            }
+            for (size_t index = 0; index < count; ++index)
+            {
+                std::string name(length, ' ');
+                for (size_t i = 0, rest = index; i < length; ++i, rest /= size)
+                {
+                    name[length - 1 - i] = "xyzw"[rest % size];
+                }
+                result.push_back(name);
+            }
+        }
+        return result;
+    }
+
+    //! Source of a translation unit using typeCount vector types and swizzleCount swizzles, each in a
+    //! function of its own (using a swizzle in an expression so that operators get instantiated too).
+    inline std::string generate(size_t typeCount, size_t swizzleCount, size_t maxSwizzleLength)
+    {
+        std::ostringstream s;
+        s << "#include <swizzle/glsl/scalar_support.h>\n";
+        s << "#include <swizzle/glsl/vector.h>\n\n";
+
+        for (size_t i = 0; i < typeCount; ++i)
+        {
+            s << "typedef swizzle::glsl::vector<" << c_scalarTypes[i / 3] << ", " << 2 + i % 3 << "> type" << i << ";\n";
+        }
+        s << "\n";
+
+        std::vector<size_t> used(typeCount);
+        for (size_t i = 0; i < swizzleCount; ++i)
+        {
+            size_t type = i % typeCount;
+            const char* scalar = c_scalarTypes[type / 3];
+            auto names = swizzle_names(2 + type % 3, maxSwizzleLength);
+            auto& name = names[used[type]++ % names.size()];
+
+            if (name.size() == 1)
+            {
+                s << scalar;
+            }
+            else
+            {
+                s << "swizzle::glsl::vector<" << scalar << ", " << name.size() << ">";
+            }
+            s << " f" << i << "(const type" << type << "& v) { return v." << name << " + v." << name << "; }\n";
+        }
+
+        return s.str();
+    }
+
+#if !defined(_WIN32)
+
+    //! Runs the command, waiting for it to finish; its output goes to /dev/null.
+    inline cost run(const std::vector<std::string>& command)
+    {
+        cost result = { false, 0, 0, 0 };
+
+        std::vector<char*> argv;
+        for (auto& arg : command)
+        {
+            argv.push_back(const_cast<char*>(arg.c_str()));
+        }
+        argv.push_back(nullptr);
+
+        auto start = std::chrono::steady_clock::now();
+        pid_t pid = fork();
+        if (pid < 0)
+        {
+            return result;
+        }
+        if (pid == 0)
+        {
+            int null = open("/dev/null", O_WRONLY);
+            dup2(null, STDOUT_FILENO);
+            dup2(null, STDERR_FILENO);
+            execvp(argv[0], argv.data());
+            _exit(127);
+        }
+
+        int status = 0;
+        struct rusage usage;
+        if (wait4(pid, &status, 0, &usage) != pid)
+        {
+            return result;
+        }
+
+        result.wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        result.cpuSeconds = usage.ru_utime.tv_sec + usage.ru_stime.tv_sec + (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1e6;
+#if defined(__APPLE__)
+        // bytes rather than kilobytes
+        result.peakMegabytes = usage.ru_maxrss / (1024.0 * 1024.0);
+#else
+        result.peakMegabytes = usage.ru_maxrss / 1024.0;
+#endif
+        result.succeeded = WIFEXITED(status) && WEXITSTATUS(status) == 0;
+        return result;
+    }
+
+#endif
+
+    //! Parses comma separated numbers.
+    inline std::vector<size_t> parse_list(const char* text)
+    {
+        std::vector<size_t> result;
+        std::istringstream s(text);
+        std::string number;
+        while (std::getline(s, number, ','))
+        {
+            result.push_back(std::strtoul(number.c_str(), nullptr, 10));
+        }
+        return result;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace compile_cost;
+
+#if defined(_WIN32)
+    (void)argc;
+    (void)argv;
+    std::cerr << "ERROR: compile_cost needs fork/wait4, which are not available on this platform" << std::endl;
+    return 1;
+#else
+    std::string compiler = COMPILE_COST_COMPILER;
+    std::string flags = "-std=c++11 -O2";
+    std::vector<size_t> typeCounts = { 1, 3, 9 };
+    std::vector<size_t> swizzleCounts = { 0, 100, 200 };
+    size_t runs = 1;
+    std::vector<configuration> configurations;
+
+    for (int i = 1; i + 1 < argc; i += 2)
+    {
+        std::string arg = argv[i];
+        if (arg == "-c")
+        {
+            compiler = argv[i + 1];
+        }
+        else if (arg == "-f")
+        {
+            flags = argv[i + 1];
+        }
+        else if (arg == "-n")
+        {
+            typeCounts = parse_list(argv[i + 1]);
+        }
+        else if (arg == "-m")
+        {
+            swizzleCounts = parse_list(argv[i + 1]);
+        }
+        else if (arg == "-r")
+        {
+            runs = std::max<size_t>(1, std::strtoul(argv[i + 1], nullptr, 10));
+        }
+        else if (arg == "-D")
+        {
+            configurations.emplace_back(argv[i + 1]);
+        }
+        else
+        {
+            std::cerr << "ERROR: unknown option " << arg << std::endl;
+            return 1;
+        }
+    }
+
+    if (configurations.empty())
+    {
+        for (auto definition : c_defaultConfigurations)
+        {
+            configurations.emplace_back(definition);
+        }
+    }
+
+    char directory[] = "/tmp/compile_cost_XXXXXX";
+    if (!mkdtemp(directory))
+    {
+        std::cerr << "ERROR: unable to create a temporary directory" << std::endl;
+        return 1;
+    }
+    std::string source = std::string(directory) + "/tu.cpp";
+    std::string object = std::string(directory) + "/tu.o";
+
+    std::cout << "compiler: " << compiler << " " << flags << ", best of " << runs << " run(s)\n\n";
+    std::cout << std::left << std::setw(48) << "configuration" << std::right << std::setw(6) << "types" << std::setw(10) << "swizzles"
+        << std::setw(10) << "wall s" << std::setw(10) << "cpu s" << std::setw(12) << "peak MB" << "\n";
+
+    for (auto& config : configurations)
+    {
+        for (size_t typeCount : typeCounts)
+        {
+            typeCount = std::min(std::max<size_t>(typeCount, 1), c_maxTypeCount);
+            for (size_t swizzleCount : swizzleCounts)
+            {
+                std::ofstream(source) << generate(typeCount, swizzleCount, config.maxSwizzleLength);
+
+                std::vector<std::string> command = { compiler };
+                std::istringstream flagStream(flags);
+                for (std::string flag; flagStream >> flag; )
+                {
+                    command.push_back(flag);
+                }
+                command.push_back("-I" COMPILE_COST_INCLUDE_DIR);
+                for (auto& macro : config.macros)
+                {
+                    command.push_back("-D" + macro);
+                }
+                command.insert(command.end(), { "-c", source, "-o", object });
+
+                cost best = { false, 0, 0, 0 };
+                for (size_t run = 0; run < runs; ++run)
+                {
+                    cost current = compile_cost::run(command);
+                    if (!current.succeeded)
+                    {
+                        best = current;
+                        break;
+                    }
+                    if (!best.succeeded || current.wallSeconds < best.wallSeconds)
+                    {
+                        best = current;
+                    }
+                }
+
+                std::cout << std::left << std::setw(48) << config.name << std::right << std::setw(6) << typeCount << std::setw(10) << swizzleCount;
+                if (best.succeeded)
+                {
+                    std::cout << std::fixed << std::setprecision(2) << std::setw(10) << best.wallSeconds << std::setw(10) << best.cpuSeconds
+                        << std::setprecision(1) << std::setw(12) << best.peakMegabytes << "\n";
+                }
+                else
+                {
+                    // stop here, so that the failing translation unit is kept
+                    std::cout << "   compilation failed, see " << source << std::endl;
+                    return 1;
+                }
+                std::cout.flush();
+            }
+        }
+    }
+
+    std::remove(source.c_str());
+    std::remove(object.c_str());
+    rmdir(directory);
+    return 0;
+#endif
+}
@@ -0,0 +1,49 @@
+// CxxSwizzle
+// Copyright (c) 2013-2015, Piotr Gwiazdowski <gwiazdorrr+github at gmail.com>
+//
+// Compile-only check that builtins called with float literals and uniforms mixed with varyings
+// resolve to a single overload for the backend; it's built as an object library and never run.
+
+#if defined(USE_SIMD)
+#include "use_simd.h"
+#else
+#include "use_scalar.h"
+#endif
+
+#include <swizzle/glsl/vector.h>
+#include <swizzle/glsl/uniform.h>
+
+typedef swizzle::glsl::vector< float_type, 1 > vec1;
+typedef swizzle::glsl::vector< float_type, 2 > vec2;
+typedef swizzle::glsl::vector< float_type, 3 > vec3;
+typedef swizzle::glsl::vector< float_type, 4 > vec4;
+
+namespace literals
+{
+    #include <swizzle/glsl/vector_functions.h>
+
+    float_type scalars(const float_type& x, const float_type& y)
+    {
+        return smoothstep(0.0f, 1.0f, x) + clamp(x, 0.0f, 1.0f) + mix(x, y, 0.5f) + step(0.5f, x) +
+            max(x, 0.0f) + min(1.0f, x) + pow(x, 2.0f);
+    }
+
+    vec1 vectors1(const vec1& x, const vec1& y)
+    {
+        return smoothstep(0.0f, 1.0f, x) + clamp(x, 0.0f, 1.0f) + mix(x, y, 0.5f) + step(0.5f, x) +
+            max(x, 0.0f) + min(x, 1.0f);
+    }
+
+    vec3 vectors3(const vec3& x, const vec3& y)
+    {
+        return smoothstep(0.0f, 1.0f, x) + clamp(x, 0.0f, 1.0f) + mix(x, y, 0.5f) + step(0.5f, x) +
+            max(x, 0.0f) + min(x, 1.0f) + x.zyx * 2.0f;
+    }
+
+    vec4 uniforms(const vec4& x, const swizzle::glsl::uniform<vec4>& u)
+    {
+        vec4 broadcast = u;
+        vec3 fromProxy = u.xyz;
+        return mix(x, broadcast, 0.5f) + vec4(fromProxy, 1.0f) + clamp(x, vec4(u), vec4(1.0f));
+    }
+}
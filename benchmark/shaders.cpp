@@ -0,0 +1,197 @@
+// CxxSwizzle
+// Copyright (c) 2013-2015, Piotr Gwiazdowski <gwiazdorrr+github at gmail.com>
+//
+// Measures how fast a whole shader runs with the backend: frames are rendered into memory on
+// a single thread, without SDL. Shaders made of many small helper functions (like gears.frag)
+// are sensitive to how arguments are passed when calls are not inlined; compare builds with
+// CXXSWIZZLE_PASS_BY_VALUE set to 0 and 1. Shaders using textures are not supported.
+// Usage: shaders_xxx [-r WxH] [-t time]
+
+#if defined(USE_SIMD)
+#include "use_simd.h"
+#else
+#include "use_scalar.h"
+#endif
+
+#include <swizzle/glsl/vector.h>
+#include <swizzle/glsl/matrix.h>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "timing.h"
+
+typedef swizzle::glsl::vector< float_type, 2 > vec2;
+typedef swizzle::glsl::vector< float_type, 3 > vec3;
+typedef swizzle::glsl::vector< float_type, 4 > vec4;
+
+typedef swizzle::glsl::matrix< swizzle::glsl::vector, vec4::scalar_type, 2, 2> mat2;
+typedef swizzle::glsl::matrix< swizzle::glsl::vector, vec4::scalar_type, 3, 3> mat3;
+typedef swizzle::glsl::matrix< swizzle::glsl::vector, vec4::scalar_type, 4, 4> mat4;
+
+#if !defined(USE_SIMD)
+const char* c_backendName = "scalar";
+#elif defined(VC_IMPL_AVX)
+const char* c_backendName = "Vc AVX";
+#elif defined(VC_IMPL_SSE)
+const char* c_backendName = "Vc SSE";
+#else
+const char* c_backendName = "Vc scalar";
+#endif
+
+// same environment as the sample's, minus textures
+namespace glsl_sandbox
+{
+    namespace ref
+    {
+        typedef vec2& vec2;
+        typedef vec3& vec3;
+        typedef vec4& vec4;
+        typedef ::float_type& float_type;
+    }
+
+    namespace in
+    {
+        typedef ::vec2::vector_arg_type vec2;
+        typedef ::vec3::vector_arg_type vec3;
+        typedef ::vec4::vector_arg_type vec4;
+        typedef ::vec4::scalar_arg_type float_type;
+    }
+
+    namespace uniforms
+    {
+        typedef swizzle::glsl::uniform<::vec2> vec2;
+        typedef swizzle::glsl::uniform<::vec3> vec3;
+        typedef swizzle::glsl::uniform<::vec4> vec4;
+        typedef swizzle::glsl::uniform<::float_type> float_type;
+    }
+
+    #include <swizzle/glsl/vector_functions.h>
+
+    uniforms::float_type time = 1;
+    uniforms::vec2 mouse(0, 0);
+    uniforms::vec2 resolution;
+
+    uniforms::vec2& iResolution = resolution;
+    uniforms::float_type& iGlobalTime = time;
+    uniforms::vec2& iMouse = mouse;
+
+    struct fragment_shader
+    {
+        vec2 gl_FragCoord;
+        vec4 gl_FragColor;
+        void operator()(void);
+    };
+
+    #define uniform extern uniforms::
+    #define in in::
+    #define out ref::
+    #define inout ref::
+    #define main fragment_shader::operator()
+    #define float float_type
+    #define bool bool_type
+
+    #pragma warning(push)
+    #pragma warning(disable: 4244) // disable return implicit conversion warning
+    #pragma warning(disable: 4305) // disable truncation warning
+
+    #ifndef SHADER_FILE
+    #define SHADER_FILE "shaders/gears.frag"
+    #endif
+    #include SHADER_FILE
+
+    #pragma warning(pop)
+    #undef bool
+    #undef float
+    #undef main
+    #undef in
+    #undef out
+    #undef inout
+    #undef uniform
+}
+
+namespace shaders
+{
+    //! Renders a frame, returning sum of all the colours (so that nothing gets optimised away).
+    inline float render(int width, int height)
+    {
+        using namespace glsl_sandbox;
+
+        // 0...scalar_count
+        float unalignedOffsets[scalar_count + float_entries_align / sizeof(float)];
+        auto value = reinterpret_cast<uintptr_t>(unalignedOffsets);
+        float* aligned = reinterpret_cast<float*>((value + float_entries_align - 1) & ~(uintptr_t)(float_entries_align - 1));
+        for (size_t i = 0; i < scalar_count; ++i)
+        {
+            aligned[i] = static_cast<float>(i);
+        }
+        raw_float_type offsets;
+        load_aligned(offsets, aligned);
+
+        fragment_shader shader;
+        vec4 sum;
+        for (int y = 0; y < height; ++y)
+        {
+            shader.gl_FragCoord.y = static_cast<float>(height - 1 - y);
+            for (int x = 0; x < width; x += static_cast<int>(scalar_count))
+            {
+                shader.gl_FragCoord.x = static_cast<float>(x) + offsets;
+                shader();
+                sum += shader.gl_FragColor;
+            }
+        }
+
+        raw_float_type total = static_cast<raw_float_type>(sum.r + sum.g + sum.b);
+        aligned[0] = 0;
+        store_aligned(total, aligned);
+        return aligned[0];
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    int width = 128;
+    int height = 96;
+    float time = 1;
+
+    for (int i = 1; i + 1 < argc; i += 2)
+    {
+        std::string arg = argv[i];
+        if (arg == "-r")
+        {
+            char separator;
+            std::istringstream s(argv[i + 1]);
+            if (!(s >> width >> separator >> height) || width <= 0 || height <= 0)
+            {
+                std::cerr << "ERROR: unable to parse resolution " << argv[i + 1] << std::endl;
+                return 1;
+            }
+        }
+        else if (arg == "-t")
+        {
+            time = static_cast<float>(std::atof(argv[i + 1]));
+        }
+    }
+
+    glsl_sandbox::time = time;
+    glsl_sandbox::resolution.x = static_cast<float>(width);
+    glsl_sandbox::resolution.y = static_cast<float>(height);
+
+    double ns = measure_ns([&](size_t iterations) -> void
+    {
+        for (size_t i = 0; i < iterations; ++i)
+        {
+            do_not_optimize(shaders::render(width, height));
+        }
+    }, std::chrono::milliseconds(200), 3) / (width * height);
+
+    std::cout << SHADER_FILE << ", backend: " << c_backendName << " (" << scalar_count << " lanes), arguments passed "
+        << (CXXSWIZZLE_PASS_BY_VALUE ? "by value" : "by reference") << "\n"
+        << width << "x" << height << ": " << std::fixed << std::setprecision(2) << ns << " ns/pixel, "
+        << 1000.0 / ns << " Mpixels/s" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,66 @@
+// CxxSwizzle
+// Copyright (c) 2013-2015, Piotr Gwiazdowski <gwiazdorrr+github at gmail.com>
+#pragma once
+
+#include <chrono>
+#include <algorithm>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+//! Makes the compiler believe the value is used, so that the computation producing it
+//! can't be optimised away.
+template <class T>
+inline void do_not_optimize(const T& value)
+{
+#if defined(_MSC_VER)
+    // no inline assembly on x64 VC++; a volatile read is the next best thing
+    volatile char sink = *reinterpret_cast<const volatile char*>(&value);
+    (void)sink;
+#else
+    asm volatile("" : : "r,m"(value) : "memory");
+#endif
+}
+
+//! Makes the compiler believe the pointed memory is read and modified at this point, so that
+//! computations depending on it can't be hoisted out of a loop.
+inline void escape(void* ptr)
+{
+#if defined(_MSC_VER)
+    static void* volatile s_sink;
+    s_sink = ptr;
+    _ReadWriteBarrier();
+#else
+    asm volatile("" : : "g"(ptr) : "memory");
+#endif
+}
+
+//! Runs func(iterations) repeatedly, doubling the iteration count until a single run takes
+//! at least minDuration, then returns the best time per iteration (in nanoseconds) of a few runs.
+template <class Func>
+double measure_ns(Func func, std::chrono::nanoseconds minDuration = std::chrono::milliseconds(20), int runs = 5)
+{
+    typedef std::chrono::high_resolution_clock clock;
+
+    size_t iterations = 1;
+    for (;;)
+    {
+        auto begin = clock::now();
+        func(iterations);
+        if (clock::now() - begin >= minDuration)
+        {
+            break;
+        }
+        iterations *= 2;
+    }
+
+    double best = 0;
+    for (int i = 0; i < runs; ++i)
+    {
+        auto begin = clock::now();
+        func(iterations);
+        double ns = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - begin).count()) / iterations;
+        best = (i == 0) ? ns : std::min(best, ns);
+    }
+    return best;
+}
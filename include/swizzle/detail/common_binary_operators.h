@@ -12,8 +12,8 @@ namespace swizzle
         //! and a scalar as friend inline functions (only accessible with ADL). The reason for that,
         //! contrary to having global template operators is there's less typing and types decaying
         //! to a vector/scalar (proxies!) can use these operators too.
-        //! Note that because VC++ is unable to align SIMD types when passing by value,
-        //! functions defined here use C++03 pass-by-reference style.
+        //! Arguments are passed by const reference by default, because VC++ is unable to align SIMD types
+        //! when passing by value; users pass their own argument types where it's cheaper (see detail::arg_type).
         template <typename VectorType, typename ScalarType, typename VectorArgType = const VectorType&, typename ScalarArgType = const ScalarType&>
         struct common_binary_operators
         {
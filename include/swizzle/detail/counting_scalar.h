@@ -0,0 +1,301 @@
+// CxxSwizzle
+// Copyright (c) 2013-2015, Piotr Gwiazdowski <gwiazdorrr+github at gmail.com>
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <algorithm>
+#include <type_traits>
+
+namespace swizzle
+{
+    namespace detail
+    {
+        //! Kinds of operations counted by counting_scalar.
+        enum op_kind
+        {
+            // arithmetic
+            op_add, op_sub, op_mul, op_div, op_neg,
+            // transcendental
+            op_sin, op_cos, op_tan, op_asin, op_acos, op_atan, op_atan2, op_pow, op_exp, op_log, op_exp2, op_log2,
+            // other functions
+            op_sqrt, op_rsqrt, op_abs, op_sign, op_floor, op_ceil, op_fract, op_mod, op_min, op_max, op_step,
+            // the rest
+            op_compare, op_assign,
+            op_kind_count
+        };
+
+        //! \return Name of the operation, as used in GLSL.
+        inline const char* get_op_name(op_kind kind)
+        {
+            static const char* const names[op_kind_count] =
+            {
+                "+", "-", "*", "/", "neg",
+                "sin", "cos", "tan", "asin", "acos", "atan", "atan2", "pow", "exp", "log", "exp2", "log2",
+                "sqrt", "inversesqrt", "abs", "sign", "floor", "ceil", "fract", "mod", "min", "max", "step",
+                "compare", "assign"
+            };
+            return names[kind];
+        }
+
+        //! A histogram of operations.
+        struct op_counters
+        {
+            uint64_t counts[op_kind_count];
+
+            op_counters()
+            {
+                reset();
+            }
+
+            void reset()
+            {
+                std::fill(counts, counts + op_kind_count, uint64_t(0));
+            }
+
+            uint64_t total() const
+            {
+                uint64_t result = 0;
+                for (auto count : counts)
+                {
+                    result += count;
+                }
+                return result;
+            }
+
+            op_counters& operator+=(const op_counters& other)
+            {
+                for (size_t i = 0; i < op_kind_count; ++i)
+                {
+                    counts[i] += other.counts[i];
+                }
+                return *this;
+            }
+
+            //! Counters of the calling thread; all the counting_scalar instances report here.
+            static op_counters& current()
+            {
+                static thread_local op_counters s_counters;
+                return s_counters;
+            }
+
+            static void count(op_kind kind)
+            {
+                ++current().counts[kind];
+            }
+        };
+
+        //! A scalar that reports every operation done on it to op_counters::current(). Meant to be an
+        //! internal_type of primitive_wrapper, so that any shader can be profiled without changing its source.
+        //! Default constructor and copying are trivial, so that it can live in vectors' unions.
+        template <typename T>
+        struct counting_scalar
+        {
+            T value;
+
+            counting_scalar() = default;
+
+            counting_scalar(T value)
+                : value(value)
+            {}
+
+            //! Explicit casts to any arithmetic type.
+            template <typename U, class = typename std::enable_if<std::is_arithmetic<U>::value>::type>
+            explicit operator U() const
+            {
+                return static_cast<U>(value);
+            }
+
+            // arithmetic
+
+            counting_scalar operator-() const
+            {
+                op_counters::count(op_neg);
+                return -value;
+            }
+
+            friend counting_scalar operator+(counting_scalar a, counting_scalar b)
+            {
+                op_counters::count(op_add);
+                return a.value + b.value;
+            }
+            friend counting_scalar operator-(counting_scalar a, counting_scalar b)
+            {
+                op_counters::count(op_sub);
+                return a.value - b.value;
+            }
+            friend counting_scalar operator*(counting_scalar a, counting_scalar b)
+            {
+                op_counters::count(op_mul);
+                return a.value * b.value;
+            }
+            friend counting_scalar operator/(counting_scalar a, counting_scalar b)
+            {
+                op_counters::count(op_div);
+                return a.value / b.value;
+            }
+
+            // comparisons
+
+            friend bool operator<(counting_scalar a, counting_scalar b)
+            {
+                op_counters::count(op_compare);
+                return a.value < b.value;
+            }
+            friend bool operator<=(counting_scalar a, counting_scalar b)
+            {
+                op_counters::count(op_compare);
+                return a.value <= b.value;
+            }
+            friend bool operator>(counting_scalar a, counting_scalar b)
+            {
+                op_counters::count(op_compare);
+                return a.value > b.value;
+            }
+            friend bool operator>=(counting_scalar a, counting_scalar b)
+            {
+                op_counters::count(op_compare);
+                return a.value >= b.value;
+            }
+            friend bool operator==(counting_scalar a, counting_scalar b)
+            {
+                op_counters::count(op_compare);
+                return a.value == b.value;
+            }
+            friend bool operator!=(counting_scalar a, counting_scalar b)
+            {
+                op_counters::count(op_compare);
+                return a.value != b.value;
+            }
+
+            // functions
+
+            friend counting_scalar sin(counting_scalar x)
+            {
+                op_counters::count(op_sin);
+                return std::sin(x.value);
+            }
+            friend counting_scalar cos(counting_scalar x)
+            {
+                op_counters::count(op_cos);
+                return std::cos(x.value);
+            }
+            friend counting_scalar tan(counting_scalar x)
+            {
+                op_counters::count(op_tan);
+                return std::tan(x.value);
+            }
+            friend counting_scalar asin(counting_scalar x)
+            {
+                op_counters::count(op_asin);
+                return std::asin(x.value);
+            }
+            friend counting_scalar acos(counting_scalar x)
+            {
+                op_counters::count(op_acos);
+                return std::acos(x.value);
+            }
+            friend counting_scalar atan(counting_scalar x)
+            {
+                op_counters::count(op_atan);
+                return std::atan(x.value);
+            }
+            friend counting_scalar atan2(counting_scalar y, counting_scalar x)
+            {
+                op_counters::count(op_atan2);
+                return std::atan2(y.value, x.value);
+            }
+            friend counting_scalar pow(counting_scalar x, counting_scalar n)
+            {
+                op_counters::count(op_pow);
+                return std::pow(x.value, n.value);
+            }
+            friend counting_scalar exp(counting_scalar x)
+            {
+                op_counters::count(op_exp);
+                return std::exp(x.value);
+            }
+            friend counting_scalar log(counting_scalar x)
+            {
+                op_counters::count(op_log);
+                return std::log(x.value);
+            }
+            friend counting_scalar exp2(counting_scalar x)
+            {
+                op_counters::count(op_exp2);
+                return std::exp2(x.value);
+            }
+            friend counting_scalar log2(counting_scalar x)
+            {
+                op_counters::count(op_log2);
+                return std::log2(x.value);
+            }
+            friend counting_scalar sqrt(counting_scalar x)
+            {
+                op_counters::count(op_sqrt);
+                return std::sqrt(x.value);
+            }
+            friend counting_scalar rsqrt(counting_scalar x)
+            {
+                op_counters::count(op_rsqrt);
+                return T(1) / std::sqrt(x.value);
+            }
+            friend counting_scalar abs(counting_scalar x)
+            {
+                op_counters::count(op_abs);
+                return std::abs(x.value);
+            }
+            friend counting_scalar sign(counting_scalar x)
+            {
+                op_counters::count(op_sign);
+                return static_cast<T>((T(0) < x.value) - (x.value < T(0)));
+            }
+            friend counting_scalar floor(counting_scalar x)
+            {
+                op_counters::count(op_floor);
+                return std::floor(x.value);
+            }
+            friend counting_scalar ceil(counting_scalar x)
+            {
+                op_counters::count(op_ceil);
+                return std::ceil(x.value);
+            }
+            friend counting_scalar fract(counting_scalar x)
+            {
+                op_counters::count(op_fract);
+                return x.value - std::floor(x.value);
+            }
+            friend counting_scalar mod(counting_scalar x, counting_scalar y)
+            {
+                op_counters::count(op_mod);
+                return x.value - y.value * std::floor(x.value / y.value);
+            }
+            friend counting_scalar min(counting_scalar x, counting_scalar y)
+            {
+                op_counters::count(op_min);
+                return std::min(x.value, y.value);
+            }
+            friend counting_scalar max(counting_scalar x, counting_scalar y)
+            {
+                op_counters::count(op_max);
+                return std::max(x.value, y.value);
+            }
+            friend counting_scalar step(counting_scalar edge, counting_scalar x)
+            {
+                op_counters::count(op_step);
+                return x.value > edge.value ? T(1) : T(0);
+            }
+        };
+
+        //! Assign policy for primitive_wrapper, counting assignments.
+        struct counting_assign_policy
+        {
+            template <typename T>
+            static void assign(T& target, const T& source)
+            {
+                op_counters::count(op_assign);
+                target = source;
+            }
+        };
+    }
+}
@@ -3,6 +3,7 @@
 #pragma once
 
 #include <cmath>
+#include <array>
 #include <swizzle/detail/utils.h>
 
 #define CXXSWIZZLE_DETAIL_SIMPLE_TRANSFORM_V(name) \
@@ -43,10 +44,10 @@ namespace swizzle
             {
             public:
                 typedef VectorType<ScalarType, Size> vector_type;
-                typedef const VectorType<ScalarType, Size>& vector_arg_type;
+                typedef typename detail::arg_type<vector_type, std::array<ScalarType, Size>>::type vector_arg_type;
                 typedef VectorType<bool, Size> bool_vector_type;
                 typedef ScalarType scalar_type;
-                typedef const ScalarType& scalar_arg_type;
+                typedef typename detail::arg_type<ScalarType>::type scalar_arg_type;
 
             private:
 
@@ -36,20 +36,27 @@ namespace swizzle
           
         public:
 
+            indexed_proxy() = default;
+
+            //! Not used, but it makes the proxy a literal type, as vectors it lives in need to be.
+            CXXSWIZZLE_CONSTEXPR explicit indexed_proxy(const DataType& data)
+                : m_data(data)
+            {}
+
             //! Convert proxy into a vector.
             vector_type decay() const
             {
                 vector_type result;
-                decay_helper<0, indices...> {result, m_data};
+                copy_to(result, make_index_sequence<num_of_components>());
                 return result;
             }
 
         #ifdef CXXSWIZZLE_VECTOR_INOUT_WRAPPER_ENABLED
             //! If enabled, it will decay to a reference wrapper, if needed (inout and out parameters); on destruction
             //! the wrapper will copy its value back into the proxy
-            operator const typename std::conditional<is_writable, vector_inout_wrapper<vector_type>, operation_not_available>::type()
+            operator typename std::conditional<is_writable, vector_inout_wrapper<vector_type>, operation_not_available>::type()
             {
-                return vector_inout_wrapper<vector_type>(decay(), [this](const vector_type& v) -> void { *this = v; });
+                return vector_inout_wrapper<vector_type>(decay(), *this);
             }
         #endif
 
@@ -68,7 +75,7 @@ namespace swizzle
             //! Assignment only enabled if proxy is writable -> has unique indexes
             indexed_proxy& operator=(const typename std::conditional<is_writable, vector_type, operation_not_available>::type& vec)
             {
-                decay_helper<0, indices...> {vec, m_data};
+                copy_from(vec, make_index_sequence<num_of_components>());
                 return *this;
             }
 
@@ -101,38 +108,21 @@ namespace swizzle
             }
 
         private:
-            //! Helper type, converts vector to or from data
-            template <size_t VectorIndex, size_t DataIndex, size_t... DataIndexTail>
-            struct decay_helper
+            //! Converts data into vector.
+            template <size_t... VectorIndices>
+            void copy_to(VectorType& vec, index_sequence<VectorIndices...>) const
             {
-                //! Convert data into vector.
-                decay_helper(VectorType& vec, const DataType& data)
-                {
-                    vec[VectorIndex] = data[DataIndex];
-                    decay_helper<VectorIndex + 1, DataIndexTail...>(vec, data);
-                }
-                //! Convert vector into data.
-                decay_helper(const VectorType& vec, DataType& data)
-                {
-                    data[DataIndex] = vec.at(VectorIndex, std::true_type());
-                    decay_helper<VectorIndex + 1, DataIndexTail...>(vec, data);
-                }
-            };
-
-            //! Terminator.
-            template <size_t VectorIndex, size_t DataIndex>
-            struct decay_helper<VectorIndex, DataIndex>
+                int expand[] = { 0, (static_cast<void>(vec.at(VectorIndices, std::true_type()) = m_data[indices]), 0)... };
+                (void)expand;
+            }
+
+            //! Converts vector into data.
+            template <size_t... VectorIndices>
+            void copy_from(const VectorType& vec, index_sequence<VectorIndices...>)
             {
-                decay_helper(VectorType& vec, const DataType& data)
-                {
-                    vec.at(VectorIndex, std::true_type()) = data[DataIndex];
-                }
-
-                decay_helper(const VectorType& vec, DataType& data)
-                {
-                    data[DataIndex] = vec.at(VectorIndex, std::true_type());
-                }
-            };
+                int expand[] = { 0, (static_cast<void>(m_data[indices] = vec.at(VectorIndices, std::true_type())), 0)... };
+                (void)expand;
+            }
         };
 
 
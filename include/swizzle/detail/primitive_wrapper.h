@@ -19,8 +19,10 @@ namespace swizzle
             typedef AssignPolicy assign_policy_type;
             typedef BoolType bool_type;
 
-            typedef const primitive_wrapper& this_arg;
-            typedef const external_type& external_type_arg;
+            //! Passed by value where it's cheap (see CXXSWIZZLE_PASS_BY_VALUE); primitive_wrapper is not
+            //! complete yet, but it is as cheap to copy as the internal type.
+            typedef typename detail::arg_type<primitive_wrapper, internal_type>::type this_arg;
+            typedef typename detail::arg_type<external_type>::type external_type_arg;
 
         private:
             internal_type data;
@@ -0,0 +1,219 @@
+// CxxSwizzle
+// Copyright (c) 2013-2015, Piotr Gwiazdowski <gwiazdorrr+github at gmail.com>
+#pragma once
+
+#include <cmath>
+#include <algorithm>
+#include <type_traits>
+
+namespace swizzle
+{
+    namespace detail
+    {
+        //! Dependencies that values don't carry: those of comparisons (i.e. of the control flow) and of
+        //! values converted to raw types (texture coordinates and the like).
+        struct dependency_tracker
+        {
+            unsigned mask;
+
+            dependency_tracker()
+                : mask(0)
+            {}
+
+            void reset()
+            {
+                mask = 0;
+            }
+
+            //! Tracker of the calling thread; all the tracking_scalar instances report here.
+            static dependency_tracker& current()
+            {
+                static thread_local dependency_tracker s_tracker;
+                return s_tracker;
+            }
+
+            static void add(unsigned dependencies)
+            {
+                current().mask |= dependencies;
+            }
+        };
+
+        //! A scalar that carries a mask of inputs (e.g. uniforms) its value has been computed from;
+        //! results of operations depend on whatever their arguments did. Meant to be an internal_type of
+        //! primitive_wrapper, so that it can be told which inputs a shader's output depends on, without
+        //! changing its source. Default constructor and copying are trivial, so that it can live in vectors' unions.
+        template <typename T>
+        struct tracking_scalar
+        {
+            T value;
+            unsigned dependencies;
+
+            tracking_scalar() = default;
+
+            tracking_scalar(T value, unsigned dependencies = 0)
+                : value(value)
+                , dependencies(dependencies)
+            {}
+
+            //! Explicit casts to any arithmetic type; the value escapes, so its dependencies get tracked.
+            template <typename U, class = typename std::enable_if<std::is_arithmetic<U>::value>::type>
+            explicit operator U() const
+            {
+                dependency_tracker::add(dependencies);
+                return static_cast<U>(value);
+            }
+
+            // arithmetic
+
+            tracking_scalar operator-() const
+            {
+                return tracking_scalar(-value, dependencies);
+            }
+
+            friend tracking_scalar operator+(tracking_scalar a, tracking_scalar b)
+            {
+                return tracking_scalar(a.value + b.value, a.dependencies | b.dependencies);
+            }
+            friend tracking_scalar operator-(tracking_scalar a, tracking_scalar b)
+            {
+                return tracking_scalar(a.value - b.value, a.dependencies | b.dependencies);
+            }
+            friend tracking_scalar operator*(tracking_scalar a, tracking_scalar b)
+            {
+                return tracking_scalar(a.value * b.value, a.dependencies | b.dependencies);
+            }
+            friend tracking_scalar operator/(tracking_scalar a, tracking_scalar b)
+            {
+                return tracking_scalar(a.value / b.value, a.dependencies | b.dependencies);
+            }
+
+            // comparisons; whatever they decide depends on their arguments
+
+            friend bool operator<(tracking_scalar a, tracking_scalar b)
+            {
+                dependency_tracker::add(a.dependencies | b.dependencies);
+                return a.value < b.value;
+            }
+            friend bool operator<=(tracking_scalar a, tracking_scalar b)
+            {
+                dependency_tracker::add(a.dependencies | b.dependencies);
+                return a.value <= b.value;
+            }
+            friend bool operator>(tracking_scalar a, tracking_scalar b)
+            {
+                dependency_tracker::add(a.dependencies | b.dependencies);
+                return a.value > b.value;
+            }
+            friend bool operator>=(tracking_scalar a, tracking_scalar b)
+            {
+                dependency_tracker::add(a.dependencies | b.dependencies);
+                return a.value >= b.value;
+            }
+            friend bool operator==(tracking_scalar a, tracking_scalar b)
+            {
+                dependency_tracker::add(a.dependencies | b.dependencies);
+                return a.value == b.value;
+            }
+            friend bool operator!=(tracking_scalar a, tracking_scalar b)
+            {
+                dependency_tracker::add(a.dependencies | b.dependencies);
+                return a.value != b.value;
+            }
+
+            // functions
+
+            friend tracking_scalar sin(tracking_scalar x)
+            {
+                return tracking_scalar(std::sin(x.value), x.dependencies);
+            }
+            friend tracking_scalar cos(tracking_scalar x)
+            {
+                return tracking_scalar(std::cos(x.value), x.dependencies);
+            }
+            friend tracking_scalar tan(tracking_scalar x)
+            {
+                return tracking_scalar(std::tan(x.value), x.dependencies);
+            }
+            friend tracking_scalar asin(tracking_scalar x)
+            {
+                return tracking_scalar(std::asin(x.value), x.dependencies);
+            }
+            friend tracking_scalar acos(tracking_scalar x)
+            {
+                return tracking_scalar(std::acos(x.value), x.dependencies);
+            }
+            friend tracking_scalar atan(tracking_scalar x)
+            {
+                return tracking_scalar(std::atan(x.value), x.dependencies);
+            }
+            friend tracking_scalar atan2(tracking_scalar y, tracking_scalar x)
+            {
+                return tracking_scalar(std::atan2(y.value, x.value), y.dependencies | x.dependencies);
+            }
+            friend tracking_scalar pow(tracking_scalar x, tracking_scalar n)
+            {
+                return tracking_scalar(std::pow(x.value, n.value), x.dependencies | n.dependencies);
+            }
+            friend tracking_scalar exp(tracking_scalar x)
+            {
+                return tracking_scalar(std::exp(x.value), x.dependencies);
+            }
+            friend tracking_scalar log(tracking_scalar x)
+            {
+                return tracking_scalar(std::log(x.value), x.dependencies);
+            }
+            friend tracking_scalar exp2(tracking_scalar x)
+            {
+                return tracking_scalar(std::exp2(x.value), x.dependencies);
+            }
+            friend tracking_scalar log2(tracking_scalar x)
+            {
+                return tracking_scalar(std::log2(x.value), x.dependencies);
+            }
+            friend tracking_scalar sqrt(tracking_scalar x)
+            {
+                return tracking_scalar(std::sqrt(x.value), x.dependencies);
+            }
+            friend tracking_scalar rsqrt(tracking_scalar x)
+            {
+                return tracking_scalar(T(1) / std::sqrt(x.value), x.dependencies);
+            }
+            friend tracking_scalar abs(tracking_scalar x)
+            {
+                return tracking_scalar(std::abs(x.value), x.dependencies);
+            }
+            friend tracking_scalar sign(tracking_scalar x)
+            {
+                return tracking_scalar(static_cast<T>((T(0) < x.value) - (x.value < T(0))), x.dependencies);
+            }
+            friend tracking_scalar floor(tracking_scalar x)
+            {
+                return tracking_scalar(std::floor(x.value), x.dependencies);
+            }
+            friend tracking_scalar ceil(tracking_scalar x)
+            {
+                return tracking_scalar(std::ceil(x.value), x.dependencies);
+            }
+            friend tracking_scalar fract(tracking_scalar x)
+            {
+                return tracking_scalar(x.value - std::floor(x.value), x.dependencies);
+            }
+            friend tracking_scalar mod(tracking_scalar x, tracking_scalar y)
+            {
+                return tracking_scalar(x.value - y.value * std::floor(x.value / y.value), x.dependencies | y.dependencies);
+            }
+            friend tracking_scalar min(tracking_scalar x, tracking_scalar y)
+            {
+                return tracking_scalar(std::min(x.value, y.value), x.dependencies | y.dependencies);
+            }
+            friend tracking_scalar max(tracking_scalar x, tracking_scalar y)
+            {
+                return tracking_scalar(std::max(x.value, y.value), x.dependencies | y.dependencies);
+            }
+            friend tracking_scalar step(tracking_scalar edge, tracking_scalar x)
+            {
+                return tracking_scalar(x.value > edge.value ? T(1) : T(0), edge.dependencies | x.dependencies);
+            }
+        };
+    }
+}
@@ -6,6 +6,24 @@
 #include <cstddef>
 #include <utility>
 
+//! constexpr where supported; VC++ before 2015 doesn't.
+#if defined(_MSC_VER) && _MSC_VER < 1900
+#define CXXSWIZZLE_CONSTEXPR
+#else
+#define CXXSWIZZLE_CONSTEXPR constexpr
+#endif
+
+//! Should small, trivially copyable arguments be passed by value? VC++ is unable to align SIMD types
+//! passed by value, but elsewhere (SysV ABI) they travel in registers, while passing by reference forces
+//! spills to memory whenever a call is not inlined. Define as 0 or 1 to override.
+#ifndef CXXSWIZZLE_PASS_BY_VALUE
+#if defined(_MSC_VER)
+#define CXXSWIZZLE_PASS_BY_VALUE 0
+#else
+#define CXXSWIZZLE_PASS_BY_VALUE 1
+#endif
+#endif
+
 namespace swizzle
 {
     namespace detail
@@ -35,63 +53,90 @@ namespace swizzle
         {};
 
 
+        //! Can T be passed in registers? It needs to be trivially copy constructible and destructible (otherwise
+        //! it is passed by an invisible reference anyway) and either up to 16 bytes or a single SIMD register.
+        template <class T>
+        struct is_register_passable : std::integral_constant<bool,
+            std::is_trivially_copy_constructible<T>::value && std::is_trivially_destructible<T>::value &&
+            (sizeof(T) <= 16 || (sizeof(T) == alignof(T) && sizeof(T) <= 64))>
+        {};
+
+        //! Argument passing policy: T by value if it is cheap (see CXXSWIZZLE_PASS_BY_VALUE), by
+        //! const reference otherwise. Storage is what T consists of, for when T is not complete yet.
+        template <class T, class Storage = T>
+        struct arg_type : std::conditional<CXXSWIZZLE_PASS_BY_VALUE && is_register_passable<Storage>::value, T, const T&>
+        {};
+
+
         //! A type to indicate that operation is not available for some combination of input types.
         struct operation_not_available;
         template <int> struct operation_not_available_n;
+        //! A complete counterpart of operation_not_available, for signatures that need to stay valid.
+        struct operation_not_available_tag {};
 
         //! An empty type carrying no information, used whenever applicable.
         struct nothing {};
 
 
-        //! Loop terminator.
-        template <size_t Begin, class Func>
-        inline void static_for_impl(Func, std::integral_constant<size_t, Begin>, std::integral_constant<size_t, Begin>)
+        //! A compile time sequence of indices, like C++14's std::index_sequence.
+        template <size_t... Indices>
+        struct index_sequence
+        {};
+
+        template <size_t N, size_t... Indices>
+        struct make_index_sequence_impl : make_index_sequence_impl<N - 1, N - 1, Indices...>
+        {};
+
+        template <size_t... Indices>
+        struct make_index_sequence_impl<0, Indices...>
         {
-            // do nothing
-        }
+            typedef index_sequence<Indices...> type;
+        };
 
-        //! A chain of func calls with each value from [Begin, End) range.
-        template <size_t Begin, size_t End, class Func>
-        inline typename std::enable_if<Begin != End, void>::type static_for_impl(Func func, std::integral_constant<size_t, Begin>, std::integral_constant<size_t, End>)
+        //! index_sequence<0, 1, ..., N-1>
+        template <size_t N>
+        using make_index_sequence = typename make_index_sequence_impl<N>::type;
+
+
+        //! Calls func with Offset + each of the indices, in order (elements of a braced initialiser list
+        //! are evaluated left to right). A flat expansion rather than a recursion, so nothing stands in the
+        //! way of inlining.
+        template <size_t Offset, class Func, size_t... Indices>
+        inline void static_for_impl(Func& func, index_sequence<Indices...>)
         {
-            func(Begin);
-            static_for_impl( func, std::integral_constant<size_t, Begin+1>(), std::integral_constant<size_t, End>() );
+            int expand[] = { 0, (static_cast<void>(func(Offset + Indices)), 0)... };
+            (void)expand;
         }
 
         //! Trigger Func for each value from [Begin, End) range.
         template <size_t Begin, size_t End, class Func>
         inline void static_for(Func func)
         {
-            static_for_impl( func, std::integral_constant<size_t, Begin>(), std::integral_constant<size_t, End>() );
+            static_assert(Begin <= End, "Invalid range");
+            static_for_impl<Begin>(func, make_index_sequence<End - Begin>());
         }
 
 
-        //! Loop terminator.
-        template <size_t Begin, class Func, typename... Args>
-        inline void static_for_with_static_call_impl(Func, std::integral_constant<size_t, Begin>, std::integral_constant<size_t, Begin>, Args&&... args)
-        {
-            // do nothing
-        }
-
-        //! A chain of func calls with each value from [Begin, End) range.
-        template <size_t Begin, size_t End, class Func, typename... Args>
-        inline typename std::enable_if<Begin != End, void>::type static_for_with_static_call_impl(Func func, std::integral_constant<size_t, Begin>, std::integral_constant<size_t, End>, Args&&... args)
+        //! Calls func's operator() templated with Offset + each of the indices, in order.
+        template <size_t Offset, class Func, size_t... Indices, typename... Args>
+        inline void static_for_with_static_call_impl(Func& func, index_sequence<Indices...>, Args&... args)
         {
 #ifdef _MSC_VER
             // VC is happy with this syntax, but unhappy with the alternative...
-            func.operator()<Begin>(std::forward<Args>(args)...);
+            int expand[] = { 0, (static_cast<void>(func.operator()<Offset + Indices>(args...)), 0)... };
 #else
             // ... that's the only option for g++. WTF?!
-            func.template operator()<Begin>(std::forward<Args>(args)...);
+            int expand[] = { 0, (static_cast<void>(func.template operator()<Offset + Indices>(args...)), 0)... };
 #endif
-            static_for_with_static_call_impl(func, std::integral_constant<size_t, Begin + 1>(), std::integral_constant<size_t, End>(), std::forward<Args>(args)...);
+            (void)expand;
         }
 
         //! Trigger Func for each value from [Begin, End) range.
         template <size_t Begin, size_t End, class Func, typename... Args>
         inline void static_for_with_static_call(Func func, Args&&... args)
         {
-            static_for_with_static_call_impl(func, std::integral_constant<size_t, Begin>(), std::integral_constant<size_t, End>(), std::forward<Args>(args)...);
+            static_assert(Begin <= End, "Invalid range");
+            static_for_with_static_call_impl<Begin>(func, make_index_sequence<End - Begin>(), args...);
         }
 
         //! Trigger Func for each value from [Begin, End) range.
@@ -2,6 +2,57 @@
 // Copyright (c) 2013-2015, Piotr Gwiazdowski <gwiazdorrr+github at gmail.com>
 #pragma once
 
+#include <swizzle/detail/utils.h>
+
+//! Name sets of swizzles: xyzw is always there, rgba and stpq can be left out (define as 0) to save on
+//! compile time and memory, as every name of every swizzle is a member of every vector.
+#ifndef CXXSWIZZLE_SWIZZLE_RGBA
+#define CXXSWIZZLE_SWIZZLE_RGBA 1
+#endif
+#ifndef CXXSWIZZLE_SWIZZLE_STPQ
+#define CXXSWIZZLE_SWIZZLE_STPQ 1
+#endif
+
+//! Longest swizzles vectors have (1 to 4); e.g. with 2 there's v.xy, but no v.xyz. Single component
+//! ones are always there.
+#ifndef CXXSWIZZLE_MAX_SWIZZLE_LENGTH
+#define CXXSWIZZLE_MAX_SWIZZLE_LENGTH 4
+#endif
+
+#if CXXSWIZZLE_SWIZZLE_RGBA
+#define CXXSWIZZLE_DETAIL_RGBA(...) __VA_ARGS__
+#else
+#define CXXSWIZZLE_DETAIL_RGBA(...)
+#endif
+
+#if CXXSWIZZLE_SWIZZLE_STPQ
+#define CXXSWIZZLE_DETAIL_STPQ(...) __VA_ARGS__
+#else
+#define CXXSWIZZLE_DETAIL_STPQ(...)
+#endif
+
+//! Declares a swizzle of given components with names from the enabled sets.
+#define CXXSWIZZLE_DETAIL_SWIZZLE(xyzw, rgba, stpq, ...) \
+    typename TProxyGenerator<__VA_ARGS__>::type xyzw CXXSWIZZLE_DETAIL_RGBA(, rgba) CXXSWIZZLE_DETAIL_STPQ(, stpq);
+
+#if CXXSWIZZLE_MAX_SWIZZLE_LENGTH >= 2
+#define CXXSWIZZLE_DETAIL_SWIZZLE2(i0, i1, xyzw, rgba, stpq) CXXSWIZZLE_DETAIL_SWIZZLE(xyzw, rgba, stpq, i0, i1)
+#else
+#define CXXSWIZZLE_DETAIL_SWIZZLE2(i0, i1, xyzw, rgba, stpq)
+#endif
+
+#if CXXSWIZZLE_MAX_SWIZZLE_LENGTH >= 3
+#define CXXSWIZZLE_DETAIL_SWIZZLE3(i0, i1, i2, xyzw, rgba, stpq) CXXSWIZZLE_DETAIL_SWIZZLE(xyzw, rgba, stpq, i0, i1, i2)
+#else
+#define CXXSWIZZLE_DETAIL_SWIZZLE3(i0, i1, i2, xyzw, rgba, stpq)
+#endif
+
+#if CXXSWIZZLE_MAX_SWIZZLE_LENGTH >= 4
+#define CXXSWIZZLE_DETAIL_SWIZZLE4(i0, i1, i2, i3, xyzw, rgba, stpq) CXXSWIZZLE_DETAIL_SWIZZLE(xyzw, rgba, stpq, i0, i1, i2, i3)
+#else
+#define CXXSWIZZLE_DETAIL_SWIZZLE4(i0, i1, i2, i3, xyzw, rgba, stpq)
+#endif
+
 namespace swizzle
 {
     namespace detail
@@ -12,6 +63,13 @@ namespace swizzle
         template <template <size_t...> class TProxyGenerator, class TData>
         struct vector_base<1, TProxyGenerator, TData>
         {
+            vector_base() = default;
+
+            //! Makes constant initialisation of vectors possible.
+            CXXSWIZZLE_CONSTEXPR vector_base(const TData& data)
+                : m_data(data)
+            {}
+
             union
             {
                 TData m_data;
@@ -19,23 +77,34 @@ namespace swizzle
                 {
                     typename TProxyGenerator<0>::type x;
                 };
+                #if CXXSWIZZLE_SWIZZLE_RGBA
                 struct
                 {
                     typename TProxyGenerator<0>::type r;
                 };
+                #endif
+                #if CXXSWIZZLE_SWIZZLE_STPQ
                 struct
                 {
                     typename TProxyGenerator<0>::type s;
                 };
-                typename TProxyGenerator<0, 0>::type xx, rr, ss;
-                typename TProxyGenerator<0, 0, 0>::type xxx, rrr, sss;
-                typename TProxyGenerator<0, 0, 0, 0>::type xxxx, rrrr, ssss;
+                #endif
+                CXXSWIZZLE_DETAIL_SWIZZLE2(0, 0, xx, rr, ss)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(0, 0, 0, xxx, rrr, sss)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 0, 0, 0, xxxx, rrrr, ssss)
             };
         };
 
         template <template <size_t...> class TProxyGenerator, class TData>
         struct vector_base<2, TProxyGenerator, TData>
         {
+            vector_base() = default;
+
+            //! Makes constant initialisation of vectors possible.
+            CXXSWIZZLE_CONSTEXPR vector_base(const TData& data)
+                : m_data(data)
+            {}
+
             union
             {
                 TData m_data;
@@ -46,52 +115,65 @@ namespace swizzle
                     typename TProxyGenerator<1>::type y;
                 };
 
+                #if CXXSWIZZLE_SWIZZLE_RGBA
+
                 struct
                 {
                     typename TProxyGenerator<0>::type r;
                     typename TProxyGenerator<1>::type g;
                 };
+                #endif
+
+                #if CXXSWIZZLE_SWIZZLE_STPQ
 
                 struct
                 {
                     typename TProxyGenerator<0>::type s;
                     typename TProxyGenerator<1>::type t;
                 };
+                #endif
 
-                typename TProxyGenerator<0,0>::type xx, rr, ss;
-                typename TProxyGenerator<0,1>::type xy, rg, st;
-                typename TProxyGenerator<1,0>::type yx, gr, ts;
-                typename TProxyGenerator<1,1>::type yy, gg, tt;
-                typename TProxyGenerator<0,0,0>::type xxx, rrr, sss;
-                typename TProxyGenerator<0,0,1>::type xxy, rrg, sst;
-                typename TProxyGenerator<0,1,0>::type xyx, rgr, sts;
-                typename TProxyGenerator<0,1,1>::type xyy, rgg, stt;
-                typename TProxyGenerator<1,0,0>::type yxx, grr, tss;
-                typename TProxyGenerator<1,0,1>::type yxy, grg, tst;
-                typename TProxyGenerator<1,1,0>::type yyx, ggr, tts;
-                typename TProxyGenerator<1,1,1>::type yyy, ggg, ttt;
-                typename TProxyGenerator<0,0,0,0>::type xxxx, rrrr, ssss;
-                typename TProxyGenerator<0,0,0,1>::type xxxy, rrrg, ssst;
-                typename TProxyGenerator<0,0,1,0>::type xxyx, rrgr, ssts;
-                typename TProxyGenerator<0,0,1,1>::type xxyy, rrgg, sstt;
-                typename TProxyGenerator<0,1,0,0>::type xyxx, rgrr, stss;
-                typename TProxyGenerator<0,1,0,1>::type xyxy, rgrg, stst;
-                typename TProxyGenerator<0,1,1,0>::type xyyx, rggr, stts;
-                typename TProxyGenerator<0,1,1,1>::type xyyy, rggg, sttt;
-                typename TProxyGenerator<1,0,0,0>::type yxxx, grrr, tsss;
-                typename TProxyGenerator<1,0,0,1>::type yxxy, grrg, tsst;
-                typename TProxyGenerator<1,0,1,0>::type yxyx, grgr, tsts;
-                typename TProxyGenerator<1,0,1,1>::type yxyy, grgg, tstt;
-                typename TProxyGenerator<1,1,0,0>::type yyxx, ggrr, ttss;
-                typename TProxyGenerator<1,1,0,1>::type yyxy, ggrg, ttst;
-                typename TProxyGenerator<1,1,1,0>::type yyyx, gggr, ttts;
-                typename TProxyGenerator<1,1,1,1>::type yyyy, gggg, tttt;
+                CXXSWIZZLE_DETAIL_SWIZZLE2(0, 0, xx, rr, ss)
+                CXXSWIZZLE_DETAIL_SWIZZLE2(0, 1, xy, rg, st)
+                CXXSWIZZLE_DETAIL_SWIZZLE2(1, 0, yx, gr, ts)
+                CXXSWIZZLE_DETAIL_SWIZZLE2(1, 1, yy, gg, tt)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(0, 0, 0, xxx, rrr, sss)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(0, 0, 1, xxy, rrg, sst)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(0, 1, 0, xyx, rgr, sts)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(0, 1, 1, xyy, rgg, stt)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(1, 0, 0, yxx, grr, tss)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(1, 0, 1, yxy, grg, tst)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(1, 1, 0, yyx, ggr, tts)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(1, 1, 1, yyy, ggg, ttt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 0, 0, 0, xxxx, rrrr, ssss)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 0, 0, 1, xxxy, rrrg, ssst)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 0, 1, 0, xxyx, rrgr, ssts)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 0, 1, 1, xxyy, rrgg, sstt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 1, 0, 0, xyxx, rgrr, stss)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 1, 0, 1, xyxy, rgrg, stst)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 1, 1, 0, xyyx, rggr, stts)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 1, 1, 1, xyyy, rggg, sttt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 0, 0, 0, yxxx, grrr, tsss)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 0, 0, 1, yxxy, grrg, tsst)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 0, 1, 0, yxyx, grgr, tsts)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 0, 1, 1, yxyy, grgg, tstt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 1, 0, 0, yyxx, ggrr, ttss)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 1, 0, 1, yyxy, ggrg, ttst)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 1, 1, 0, yyyx, gggr, ttts)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 1, 1, 1, yyyy, gggg, tttt)
             };
         };
 
         template <template <size_t...> class TProxyGenerator, class TData>
         struct vector_base<3, TProxyGenerator, TData>
         {
+            vector_base() = default;
+
+            //! Makes constant initialisation of vectors possible.
+            CXXSWIZZLE_CONSTEXPR vector_base(const TData& data)
+                : m_data(data)
+            {}
+
             union
             {
                 TData m_data;
@@ -103,12 +185,17 @@ namespace swizzle
                     typename TProxyGenerator<2>::type z;
                 };
 
+                #if CXXSWIZZLE_SWIZZLE_RGBA
+
                 struct
                 {
                     typename TProxyGenerator<0>::type r;
                     typename TProxyGenerator<1>::type g;
                     typename TProxyGenerator<2>::type b;
                 };
+                #endif
+
+                #if CXXSWIZZLE_SWIZZLE_STPQ
 
                 struct
                 {
@@ -116,130 +203,138 @@ namespace swizzle
                     typename TProxyGenerator<1>::type t;
                     typename TProxyGenerator<2>::type p;
                 };
+                #endif
 
-                typename TProxyGenerator<0,0>::type xx, rr, ss;
-                typename TProxyGenerator<0,1>::type xy, rg, st;
-                typename TProxyGenerator<0,2>::type xz, rb, sp;
-                typename TProxyGenerator<1,0>::type yx, gr, ts;
-                typename TProxyGenerator<1,1>::type yy, gg, tt;
-                typename TProxyGenerator<1,2>::type yz, gb, tp;
-                typename TProxyGenerator<2,0>::type zx, br, ps;
-                typename TProxyGenerator<2,1>::type zy, bg, pt;
-                typename TProxyGenerator<2,2>::type zz, bb, pp;
-                typename TProxyGenerator<0,0,0>::type xxx, rrr, sss;
-                typename TProxyGenerator<0,0,1>::type xxy, rrg, sst;
-                typename TProxyGenerator<0,0,2>::type xxz, rrb, ssp;
-                typename TProxyGenerator<0,1,0>::type xyx, rgr, sts;
-                typename TProxyGenerator<0,1,1>::type xyy, rgg, stt;
-                typename TProxyGenerator<0,1,2>::type xyz, rgb, stp;
-                typename TProxyGenerator<0,2,0>::type xzx, rbr, sps;
-                typename TProxyGenerator<0,2,1>::type xzy, rbg, spt;
-                typename TProxyGenerator<0,2,2>::type xzz, rbb, spp;
-                typename TProxyGenerator<1,0,0>::type yxx, grr, tss;
-                typename TProxyGenerator<1,0,1>::type yxy, grg, tst;
-                typename TProxyGenerator<1,0,2>::type yxz, grb, tsp;
-                typename TProxyGenerator<1,1,0>::type yyx, ggr, tts;
-                typename TProxyGenerator<1,1,1>::type yyy, ggg, ttt;
-                typename TProxyGenerator<1,1,2>::type yyz, ggb, ttp;
-                typename TProxyGenerator<1,2,0>::type yzx, gbr, tps;
-                typename TProxyGenerator<1,2,1>::type yzy, gbg, tpt;
-                typename TProxyGenerator<1,2,2>::type yzz, gbb, tpp;
-                typename TProxyGenerator<2,0,0>::type zxx, brr, pss;
-                typename TProxyGenerator<2,0,1>::type zxy, brg, pst;
-                typename TProxyGenerator<2,0,2>::type zxz, brb, psp;
-                typename TProxyGenerator<2,1,0>::type zyx, bgr, pts;
-                typename TProxyGenerator<2,1,1>::type zyy, bgg, ptt;
-                typename TProxyGenerator<2,1,2>::type zyz, bgb, ptp;
-                typename TProxyGenerator<2,2,0>::type zzx, bbr, pps;
-                typename TProxyGenerator<2,2,1>::type zzy, bbg, ppt;
-                typename TProxyGenerator<2,2,2>::type zzz, bbb, ppp;
-                typename TProxyGenerator<0,0,0,0>::type xxxx, rrrr, ssss;
-                typename TProxyGenerator<0,0,0,1>::type xxxy, rrrg, ssst;
-                typename TProxyGenerator<0,0,0,2>::type xxxz, rrrb, sssp;
-                typename TProxyGenerator<0,0,1,0>::type xxyx, rrgr, ssts;
-                typename TProxyGenerator<0,0,1,1>::type xxyy, rrgg, sstt;
-                typename TProxyGenerator<0,0,1,2>::type xxyz, rrgb, sstp;
-                typename TProxyGenerator<0,0,2,0>::type xxzx, rrbr, ssps;
-                typename TProxyGenerator<0,0,2,1>::type xxzy, rrbg, sspt;
-                typename TProxyGenerator<0,0,2,2>::type xxzz, rrbb, sspp;
-                typename TProxyGenerator<0,1,0,0>::type xyxx, rgrr, stss;
-                typename TProxyGenerator<0,1,0,1>::type xyxy, rgrg, stst;
-                typename TProxyGenerator<0,1,0,2>::type xyxz, rgrb, stsp;
-                typename TProxyGenerator<0,1,1,0>::type xyyx, rggr, stts;
-                typename TProxyGenerator<0,1,1,1>::type xyyy, rggg, sttt;
-                typename TProxyGenerator<0,1,1,2>::type xyyz, rggb, sttp;
-                typename TProxyGenerator<0,1,2,0>::type xyzx, rgbr, stps;
-                typename TProxyGenerator<0,1,2,1>::type xyzy, rgbg, stpt;
-                typename TProxyGenerator<0,1,2,2>::type xyzz, rgbb, stpp;
-                typename TProxyGenerator<0,2,0,0>::type xzxx, rbrr, spss;
-                typename TProxyGenerator<0,2,0,1>::type xzxy, rbrg, spst;
-                typename TProxyGenerator<0,2,0,2>::type xzxz, rbrb, spsp;
-                typename TProxyGenerator<0,2,1,0>::type xzyx, rbgr, spts;
-                typename TProxyGenerator<0,2,1,1>::type xzyy, rbgg, sptt;
-                typename TProxyGenerator<0,2,1,2>::type xzyz, rbgb, sptp;
-                typename TProxyGenerator<0,2,2,0>::type xzzx, rbbr, spps;
-                typename TProxyGenerator<0,2,2,1>::type xzzy, rbbg, sppt;
-                typename TProxyGenerator<0,2,2,2>::type xzzz, rbbb, sppp;
-                typename TProxyGenerator<1,0,0,0>::type yxxx, grrr, tsss;
-                typename TProxyGenerator<1,0,0,1>::type yxxy, grrg, tsst;
-                typename TProxyGenerator<1,0,0,2>::type yxxz, grrb, tssp;
-                typename TProxyGenerator<1,0,1,0>::type yxyx, grgr, tsts;
-                typename TProxyGenerator<1,0,1,1>::type yxyy, grgg, tstt;
-                typename TProxyGenerator<1,0,1,2>::type yxyz, grgb, tstp;
-                typename TProxyGenerator<1,0,2,0>::type yxzx, grbr, tsps;
-                typename TProxyGenerator<1,0,2,1>::type yxzy, grbg, tspt;
-                typename TProxyGenerator<1,0,2,2>::type yxzz, grbb, tspp;
-                typename TProxyGenerator<1,1,0,0>::type yyxx, ggrr, ttss;
-                typename TProxyGenerator<1,1,0,1>::type yyxy, ggrg, ttst;
-                typename TProxyGenerator<1,1,0,2>::type yyxz, ggrb, ttsp;
-                typename TProxyGenerator<1,1,1,0>::type yyyx, gggr, ttts;
-                typename TProxyGenerator<1,1,1,1>::type yyyy, gggg, tttt;
-                typename TProxyGenerator<1,1,1,2>::type yyyz, gggb, tttp;
-                typename TProxyGenerator<1,1,2,0>::type yyzx, ggbr, ttps;
-                typename TProxyGenerator<1,1,2,1>::type yyzy, ggbg, ttpt;
-                typename TProxyGenerator<1,1,2,2>::type yyzz, ggbb, ttpp;
-                typename TProxyGenerator<1,2,0,0>::type yzxx, gbrr, tpss;
-                typename TProxyGenerator<1,2,0,1>::type yzxy, gbrg, tpst;
-                typename TProxyGenerator<1,2,0,2>::type yzxz, gbrb, tpsp;
-                typename TProxyGenerator<1,2,1,0>::type yzyx, gbgr, tpts;
-                typename TProxyGenerator<1,2,1,1>::type yzyy, gbgg, tptt;
-                typename TProxyGenerator<1,2,1,2>::type yzyz, gbgb, tptp;
-                typename TProxyGenerator<1,2,2,0>::type yzzx, gbbr, tpps;
-                typename TProxyGenerator<1,2,2,1>::type yzzy, gbbg, tppt;
-                typename TProxyGenerator<1,2,2,2>::type yzzz, gbbb, tppp;
-                typename TProxyGenerator<2,0,0,0>::type zxxx, brrr, psss;
-                typename TProxyGenerator<2,0,0,1>::type zxxy, brrg, psst;
-                typename TProxyGenerator<2,0,0,2>::type zxxz, brrb, pssp;
-                typename TProxyGenerator<2,0,1,0>::type zxyx, brgr, psts;
-                typename TProxyGenerator<2,0,1,1>::type zxyy, brgg, pstt;
-                typename TProxyGenerator<2,0,1,2>::type zxyz, brgb, pstp;
-                typename TProxyGenerator<2,0,2,0>::type zxzx, brbr, psps;
-                typename TProxyGenerator<2,0,2,1>::type zxzy, brbg, pspt;
-                typename TProxyGenerator<2,0,2,2>::type zxzz, brbb, pspp;
-                typename TProxyGenerator<2,1,0,0>::type zyxx, bgrr, ptss;
-                typename TProxyGenerator<2,1,0,1>::type zyxy, bgrg, ptst;
-                typename TProxyGenerator<2,1,0,2>::type zyxz, bgrb, ptsp;
-                typename TProxyGenerator<2,1,1,0>::type zyyx, bggr, ptts;
-                typename TProxyGenerator<2,1,1,1>::type zyyy, bggg, pttt;
-                typename TProxyGenerator<2,1,1,2>::type zyyz, bggb, pttp;
-                typename TProxyGenerator<2,1,2,0>::type zyzx, bgbr, ptps;
-                typename TProxyGenerator<2,1,2,1>::type zyzy, bgbg, ptpt;
-                typename TProxyGenerator<2,1,2,2>::type zyzz, bgbb, ptpp;
-                typename TProxyGenerator<2,2,0,0>::type zzxx, bbrr, ppss;
-                typename TProxyGenerator<2,2,0,1>::type zzxy, bbrg, ppst;
-                typename TProxyGenerator<2,2,0,2>::type zzxz, bbrb, ppsp;
-                typename TProxyGenerator<2,2,1,0>::type zzyx, bbgr, ppts;
-                typename TProxyGenerator<2,2,1,1>::type zzyy, bbgg, pptt;
-                typename TProxyGenerator<2,2,1,2>::type zzyz, bbgb, pptp;
-                typename TProxyGenerator<2,2,2,0>::type zzzx, bbbr, ppps;
-                typename TProxyGenerator<2,2,2,1>::type zzzy, bbbg, pppt;
-                typename TProxyGenerator<2,2,2,2>::type zzzz, bbbb, pppp;
+                CXXSWIZZLE_DETAIL_SWIZZLE2(0, 0, xx, rr, ss)
+                CXXSWIZZLE_DETAIL_SWIZZLE2(0, 1, xy, rg, st)
+                CXXSWIZZLE_DETAIL_SWIZZLE2(0, 2, xz, rb, sp)
+                CXXSWIZZLE_DETAIL_SWIZZLE2(1, 0, yx, gr, ts)
+                CXXSWIZZLE_DETAIL_SWIZZLE2(1, 1, yy, gg, tt)
+                CXXSWIZZLE_DETAIL_SWIZZLE2(1, 2, yz, gb, tp)
+                CXXSWIZZLE_DETAIL_SWIZZLE2(2, 0, zx, br, ps)
+                CXXSWIZZLE_DETAIL_SWIZZLE2(2, 1, zy, bg, pt)
+                CXXSWIZZLE_DETAIL_SWIZZLE2(2, 2, zz, bb, pp)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(0, 0, 0, xxx, rrr, sss)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(0, 0, 1, xxy, rrg, sst)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(0, 0, 2, xxz, rrb, ssp)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(0, 1, 0, xyx, rgr, sts)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(0, 1, 1, xyy, rgg, stt)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(0, 1, 2, xyz, rgb, stp)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(0, 2, 0, xzx, rbr, sps)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(0, 2, 1, xzy, rbg, spt)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(0, 2, 2, xzz, rbb, spp)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(1, 0, 0, yxx, grr, tss)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(1, 0, 1, yxy, grg, tst)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(1, 0, 2, yxz, grb, tsp)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(1, 1, 0, yyx, ggr, tts)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(1, 1, 1, yyy, ggg, ttt)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(1, 1, 2, yyz, ggb, ttp)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(1, 2, 0, yzx, gbr, tps)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(1, 2, 1, yzy, gbg, tpt)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(1, 2, 2, yzz, gbb, tpp)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(2, 0, 0, zxx, brr, pss)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(2, 0, 1, zxy, brg, pst)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(2, 0, 2, zxz, brb, psp)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(2, 1, 0, zyx, bgr, pts)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(2, 1, 1, zyy, bgg, ptt)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(2, 1, 2, zyz, bgb, ptp)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(2, 2, 0, zzx, bbr, pps)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(2, 2, 1, zzy, bbg, ppt)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(2, 2, 2, zzz, bbb, ppp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 0, 0, 0, xxxx, rrrr, ssss)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 0, 0, 1, xxxy, rrrg, ssst)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 0, 0, 2, xxxz, rrrb, sssp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 0, 1, 0, xxyx, rrgr, ssts)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 0, 1, 1, xxyy, rrgg, sstt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 0, 1, 2, xxyz, rrgb, sstp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 0, 2, 0, xxzx, rrbr, ssps)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 0, 2, 1, xxzy, rrbg, sspt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 0, 2, 2, xxzz, rrbb, sspp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 1, 0, 0, xyxx, rgrr, stss)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 1, 0, 1, xyxy, rgrg, stst)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 1, 0, 2, xyxz, rgrb, stsp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 1, 1, 0, xyyx, rggr, stts)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 1, 1, 1, xyyy, rggg, sttt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 1, 1, 2, xyyz, rggb, sttp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 1, 2, 0, xyzx, rgbr, stps)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 1, 2, 1, xyzy, rgbg, stpt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 1, 2, 2, xyzz, rgbb, stpp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 2, 0, 0, xzxx, rbrr, spss)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 2, 0, 1, xzxy, rbrg, spst)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 2, 0, 2, xzxz, rbrb, spsp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 2, 1, 0, xzyx, rbgr, spts)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 2, 1, 1, xzyy, rbgg, sptt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 2, 1, 2, xzyz, rbgb, sptp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 2, 2, 0, xzzx, rbbr, spps)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 2, 2, 1, xzzy, rbbg, sppt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 2, 2, 2, xzzz, rbbb, sppp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 0, 0, 0, yxxx, grrr, tsss)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 0, 0, 1, yxxy, grrg, tsst)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 0, 0, 2, yxxz, grrb, tssp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 0, 1, 0, yxyx, grgr, tsts)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 0, 1, 1, yxyy, grgg, tstt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 0, 1, 2, yxyz, grgb, tstp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 0, 2, 0, yxzx, grbr, tsps)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 0, 2, 1, yxzy, grbg, tspt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 0, 2, 2, yxzz, grbb, tspp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 1, 0, 0, yyxx, ggrr, ttss)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 1, 0, 1, yyxy, ggrg, ttst)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 1, 0, 2, yyxz, ggrb, ttsp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 1, 1, 0, yyyx, gggr, ttts)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 1, 1, 1, yyyy, gggg, tttt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 1, 1, 2, yyyz, gggb, tttp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 1, 2, 0, yyzx, ggbr, ttps)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 1, 2, 1, yyzy, ggbg, ttpt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 1, 2, 2, yyzz, ggbb, ttpp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 2, 0, 0, yzxx, gbrr, tpss)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 2, 0, 1, yzxy, gbrg, tpst)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 2, 0, 2, yzxz, gbrb, tpsp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 2, 1, 0, yzyx, gbgr, tpts)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 2, 1, 1, yzyy, gbgg, tptt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 2, 1, 2, yzyz, gbgb, tptp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 2, 2, 0, yzzx, gbbr, tpps)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 2, 2, 1, yzzy, gbbg, tppt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 2, 2, 2, yzzz, gbbb, tppp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 0, 0, 0, zxxx, brrr, psss)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 0, 0, 1, zxxy, brrg, psst)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 0, 0, 2, zxxz, brrb, pssp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 0, 1, 0, zxyx, brgr, psts)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 0, 1, 1, zxyy, brgg, pstt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 0, 1, 2, zxyz, brgb, pstp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 0, 2, 0, zxzx, brbr, psps)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 0, 2, 1, zxzy, brbg, pspt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 0, 2, 2, zxzz, brbb, pspp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 1, 0, 0, zyxx, bgrr, ptss)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 1, 0, 1, zyxy, bgrg, ptst)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 1, 0, 2, zyxz, bgrb, ptsp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 1, 1, 0, zyyx, bggr, ptts)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 1, 1, 1, zyyy, bggg, pttt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 1, 1, 2, zyyz, bggb, pttp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 1, 2, 0, zyzx, bgbr, ptps)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 1, 2, 1, zyzy, bgbg, ptpt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 1, 2, 2, zyzz, bgbb, ptpp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 2, 0, 0, zzxx, bbrr, ppss)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 2, 0, 1, zzxy, bbrg, ppst)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 2, 0, 2, zzxz, bbrb, ppsp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 2, 1, 0, zzyx, bbgr, ppts)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 2, 1, 1, zzyy, bbgg, pptt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 2, 1, 2, zzyz, bbgb, pptp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 2, 2, 0, zzzx, bbbr, ppps)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 2, 2, 1, zzzy, bbbg, pppt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 2, 2, 2, zzzz, bbbb, pppp)
             };
         };
 
         template <template <size_t...> class TProxyGenerator, class TData>
         struct vector_base<4, TProxyGenerator, TData>
         {
+            vector_base() = default;
+
+            //! Makes constant initialisation of vectors possible.
+            CXXSWIZZLE_CONSTEXPR vector_base(const TData& data)
+                : m_data(data)
+            {}
+
             union
             {
                 TData m_data;
@@ -252,6 +347,8 @@ namespace swizzle
                     typename TProxyGenerator<3>::type w;
                 };
 
+                #if CXXSWIZZLE_SWIZZLE_RGBA
+
                 struct
                 {
                     typename TProxyGenerator<0>::type r;
@@ -259,6 +356,9 @@ namespace swizzle
                     typename TProxyGenerator<2>::type b;
                     typename TProxyGenerator<3>::type a;
                 };
+                #endif
+
+                #if CXXSWIZZLE_SWIZZLE_STPQ
 
                 struct
                 {
@@ -267,344 +367,352 @@ namespace swizzle
                     typename TProxyGenerator<2>::type p;
                     typename TProxyGenerator<3>::type q;
                 };
+                #endif
 
-                typename TProxyGenerator<0,0>::type xx, rr, ss;
-                typename TProxyGenerator<0,1>::type xy, rg, st;
-                typename TProxyGenerator<0,2>::type xz, rb, sp;
-                typename TProxyGenerator<0,3>::type xw, ra, sq;
-                typename TProxyGenerator<1,0>::type yx, gr, ts;
-                typename TProxyGenerator<1,1>::type yy, gg, tt;
-                typename TProxyGenerator<1,2>::type yz, gb, tp;
-                typename TProxyGenerator<1,3>::type yw, ga, tq;
-                typename TProxyGenerator<2,0>::type zx, br, ps;
-                typename TProxyGenerator<2,1>::type zy, bg, pt;
-                typename TProxyGenerator<2,2>::type zz, bb, pp;
-                typename TProxyGenerator<2,3>::type zw, ba, pq;
-                typename TProxyGenerator<3,0>::type wx, ar, qs;
-                typename TProxyGenerator<3,1>::type wy, ag, qt;
-                typename TProxyGenerator<3,2>::type wz, ab, qp;
-                typename TProxyGenerator<3,3>::type ww, aa, qq;
-                typename TProxyGenerator<0,0,0>::type xxx, rrr, sss;
-                typename TProxyGenerator<0,0,1>::type xxy, rrg, sst;
-                typename TProxyGenerator<0,0,2>::type xxz, rrb, ssp;
-                typename TProxyGenerator<0,0,3>::type xxw, rra, ssq;
-                typename TProxyGenerator<0,1,0>::type xyx, rgr, sts;
-                typename TProxyGenerator<0,1,1>::type xyy, rgg, stt;
-                typename TProxyGenerator<0,1,2>::type xyz, rgb, stp;
-                typename TProxyGenerator<0,1,3>::type xyw, rga, stq;
-                typename TProxyGenerator<0,2,0>::type xzx, rbr, sps;
-                typename TProxyGenerator<0,2,1>::type xzy, rbg, spt;
-                typename TProxyGenerator<0,2,2>::type xzz, rbb, spp;
-                typename TProxyGenerator<0,2,3>::type xzw, rba, spq;
-                typename TProxyGenerator<0,3,0>::type xwx, rar, sqs;
-                typename TProxyGenerator<0,3,1>::type xwy, rag, sqt;
-                typename TProxyGenerator<0,3,2>::type xwz, rab, sqp;
-                typename TProxyGenerator<0,3,3>::type xww, raa, sqq;
-                typename TProxyGenerator<1,0,0>::type yxx, grr, tss;
-                typename TProxyGenerator<1,0,1>::type yxy, grg, tst;
-                typename TProxyGenerator<1,0,2>::type yxz, grb, tsp;
-                typename TProxyGenerator<1,0,3>::type yxw, gra, tsq;
-                typename TProxyGenerator<1,1,0>::type yyx, ggr, tts;
-                typename TProxyGenerator<1,1,1>::type yyy, ggg, ttt;
-                typename TProxyGenerator<1,1,2>::type yyz, ggb, ttp;
-                typename TProxyGenerator<1,1,3>::type yyw, gga, ttq;
-                typename TProxyGenerator<1,2,0>::type yzx, gbr, tps;
-                typename TProxyGenerator<1,2,1>::type yzy, gbg, tpt;
-                typename TProxyGenerator<1,2,2>::type yzz, gbb, tpp;
-                typename TProxyGenerator<1,2,3>::type yzw, gba, tpq;
-                typename TProxyGenerator<1,3,0>::type ywx, gar, tqs;
-                typename TProxyGenerator<1,3,1>::type ywy, gag, tqt;
-                typename TProxyGenerator<1,3,2>::type ywz, gab, tqp;
-                typename TProxyGenerator<1,3,3>::type yww, gaa, tqq;
-                typename TProxyGenerator<2,0,0>::type zxx, brr, pss;
-                typename TProxyGenerator<2,0,1>::type zxy, brg, pst;
-                typename TProxyGenerator<2,0,2>::type zxz, brb, psp;
-                typename TProxyGenerator<2,0,3>::type zxw, bra, psq;
-                typename TProxyGenerator<2,1,0>::type zyx, bgr, pts;
-                typename TProxyGenerator<2,1,1>::type zyy, bgg, ptt;
-                typename TProxyGenerator<2,1,2>::type zyz, bgb, ptp;
-                typename TProxyGenerator<2,1,3>::type zyw, bga, ptq;
-                typename TProxyGenerator<2,2,0>::type zzx, bbr, pps;
-                typename TProxyGenerator<2,2,1>::type zzy, bbg, ppt;
-                typename TProxyGenerator<2,2,2>::type zzz, bbb, ppp;
-                typename TProxyGenerator<2,2,3>::type zzw, bba, ppq;
-                typename TProxyGenerator<2,3,0>::type zwx, bar, pqs;
-                typename TProxyGenerator<2,3,1>::type zwy, bag, pqt;
-                typename TProxyGenerator<2,3,2>::type zwz, bab, pqp;
-                typename TProxyGenerator<2,3,3>::type zww, baa, pqq;
-                typename TProxyGenerator<3,0,0>::type wxx, arr, qss;
-                typename TProxyGenerator<3,0,1>::type wxy, arg, qst;
-                typename TProxyGenerator<3,0,2>::type wxz, arb, qsp;
-                typename TProxyGenerator<3,0,3>::type wxw, ara, qsq;
-                typename TProxyGenerator<3,1,0>::type wyx, agr, qts;
-                typename TProxyGenerator<3,1,1>::type wyy, agg, qtt;
-                typename TProxyGenerator<3,1,2>::type wyz, agb, qtp;
-                typename TProxyGenerator<3,1,3>::type wyw, aga, qtq;
-                typename TProxyGenerator<3,2,0>::type wzx, abr, qps;
-                typename TProxyGenerator<3,2,1>::type wzy, abg, qpt;
-                typename TProxyGenerator<3,2,2>::type wzz, abb, qpp;
-                typename TProxyGenerator<3,2,3>::type wzw, aba, qpq;
-                typename TProxyGenerator<3,3,0>::type wwx, aar, qqs;
-                typename TProxyGenerator<3,3,1>::type wwy, aag, qqt;
-                typename TProxyGenerator<3,3,2>::type wwz, aab, qqp;
-                typename TProxyGenerator<3,3,3>::type www, aaa, qqq;
-                typename TProxyGenerator<0,0,0,0>::type xxxx, rrrr, ssss;
-                typename TProxyGenerator<0,0,0,1>::type xxxy, rrrg, ssst;
-                typename TProxyGenerator<0,0,0,2>::type xxxz, rrrb, sssp;
-                typename TProxyGenerator<0,0,0,3>::type xxxw, rrra, sssq;
-                typename TProxyGenerator<0,0,1,0>::type xxyx, rrgr, ssts;
-                typename TProxyGenerator<0,0,1,1>::type xxyy, rrgg, sstt;
-                typename TProxyGenerator<0,0,1,2>::type xxyz, rrgb, sstp;
-                typename TProxyGenerator<0,0,1,3>::type xxyw, rrga, sstq;
-                typename TProxyGenerator<0,0,2,0>::type xxzx, rrbr, ssps;
-                typename TProxyGenerator<0,0,2,1>::type xxzy, rrbg, sspt;
-                typename TProxyGenerator<0,0,2,2>::type xxzz, rrbb, sspp;
-                typename TProxyGenerator<0,0,2,3>::type xxzw, rrba, sspq;
-                typename TProxyGenerator<0,0,3,0>::type xxwx, rrar, ssqs;
-                typename TProxyGenerator<0,0,3,1>::type xxwy, rrag, ssqt;
-                typename TProxyGenerator<0,0,3,2>::type xxwz, rrab, ssqp;
-                typename TProxyGenerator<0,0,3,3>::type xxww, rraa, ssqq;
-                typename TProxyGenerator<0,1,0,0>::type xyxx, rgrr, stss;
-                typename TProxyGenerator<0,1,0,1>::type xyxy, rgrg, stst;
-                typename TProxyGenerator<0,1,0,2>::type xyxz, rgrb, stsp;
-                typename TProxyGenerator<0,1,0,3>::type xyxw, rgra, stsq;
-                typename TProxyGenerator<0,1,1,0>::type xyyx, rggr, stts;
-                typename TProxyGenerator<0,1,1,1>::type xyyy, rggg, sttt;
-                typename TProxyGenerator<0,1,1,2>::type xyyz, rggb, sttp;
-                typename TProxyGenerator<0,1,1,3>::type xyyw, rgga, sttq;
-                typename TProxyGenerator<0,1,2,0>::type xyzx, rgbr, stps;
-                typename TProxyGenerator<0,1,2,1>::type xyzy, rgbg, stpt;
-                typename TProxyGenerator<0,1,2,2>::type xyzz, rgbb, stpp;
-                typename TProxyGenerator<0,1,2,3>::type xyzw, rgba, stpq;
-                typename TProxyGenerator<0,1,3,0>::type xywx, rgar, stqs;
-                typename TProxyGenerator<0,1,3,1>::type xywy, rgag, stqt;
-                typename TProxyGenerator<0,1,3,2>::type xywz, rgab, stqp;
-                typename TProxyGenerator<0,1,3,3>::type xyww, rgaa, stqq;
-                typename TProxyGenerator<0,2,0,0>::type xzxx, rbrr, spss;
-                typename TProxyGenerator<0,2,0,1>::type xzxy, rbrg, spst;
-                typename TProxyGenerator<0,2,0,2>::type xzxz, rbrb, spsp;
-                typename TProxyGenerator<0,2,0,3>::type xzxw, rbra, spsq;
-                typename TProxyGenerator<0,2,1,0>::type xzyx, rbgr, spts;
-                typename TProxyGenerator<0,2,1,1>::type xzyy, rbgg, sptt;
-                typename TProxyGenerator<0,2,1,2>::type xzyz, rbgb, sptp;
-                typename TProxyGenerator<0,2,1,3>::type xzyw, rbga, sptq;
-                typename TProxyGenerator<0,2,2,0>::type xzzx, rbbr, spps;
-                typename TProxyGenerator<0,2,2,1>::type xzzy, rbbg, sppt;
-                typename TProxyGenerator<0,2,2,2>::type xzzz, rbbb, sppp;
-                typename TProxyGenerator<0,2,2,3>::type xzzw, rbba, sppq;
-                typename TProxyGenerator<0,2,3,0>::type xzwx, rbar, spqs;
-                typename TProxyGenerator<0,2,3,1>::type xzwy, rbag, spqt;
-                typename TProxyGenerator<0,2,3,2>::type xzwz, rbab, spqp;
-                typename TProxyGenerator<0,2,3,3>::type xzww, rbaa, spqq;
-                typename TProxyGenerator<0,3,0,0>::type xwxx, rarr, sqss;
-                typename TProxyGenerator<0,3,0,1>::type xwxy, rarg, sqst;
-                typename TProxyGenerator<0,3,0,2>::type xwxz, rarb, sqsp;
-                typename TProxyGenerator<0,3,0,3>::type xwxw, rara, sqsq;
-                typename TProxyGenerator<0,3,1,0>::type xwyx, ragr, sqts;
-                typename TProxyGenerator<0,3,1,1>::type xwyy, ragg, sqtt;
-                typename TProxyGenerator<0,3,1,2>::type xwyz, ragb, sqtp;
-                typename TProxyGenerator<0,3,1,3>::type xwyw, raga, sqtq;
-                typename TProxyGenerator<0,3,2,0>::type xwzx, rabr, sqps;
-                typename TProxyGenerator<0,3,2,1>::type xwzy, rabg, sqpt;
-                typename TProxyGenerator<0,3,2,2>::type xwzz, rabb, sqpp;
-                typename TProxyGenerator<0,3,2,3>::type xwzw, raba, sqpq;
-                typename TProxyGenerator<0,3,3,0>::type xwwx, raar, sqqs;
-                typename TProxyGenerator<0,3,3,1>::type xwwy, raag, sqqt;
-                typename TProxyGenerator<0,3,3,2>::type xwwz, raab, sqqp;
-                typename TProxyGenerator<0,3,3,3>::type xwww, raaa, sqqq;
-                typename TProxyGenerator<1,0,0,0>::type yxxx, grrr, tsss;
-                typename TProxyGenerator<1,0,0,1>::type yxxy, grrg, tsst;
-                typename TProxyGenerator<1,0,0,2>::type yxxz, grrb, tssp;
-                typename TProxyGenerator<1,0,0,3>::type yxxw, grra, tssq;
-                typename TProxyGenerator<1,0,1,0>::type yxyx, grgr, tsts;
-                typename TProxyGenerator<1,0,1,1>::type yxyy, grgg, tstt;
-                typename TProxyGenerator<1,0,1,2>::type yxyz, grgb, tstp;
-                typename TProxyGenerator<1,0,1,3>::type yxyw, grga, tstq;
-                typename TProxyGenerator<1,0,2,0>::type yxzx, grbr, tsps;
-                typename TProxyGenerator<1,0,2,1>::type yxzy, grbg, tspt;
-                typename TProxyGenerator<1,0,2,2>::type yxzz, grbb, tspp;
-                typename TProxyGenerator<1,0,2,3>::type yxzw, grba, tspq;
-                typename TProxyGenerator<1,0,3,0>::type yxwx, grar, tsqs;
-                typename TProxyGenerator<1,0,3,1>::type yxwy, grag, tsqt;
-                typename TProxyGenerator<1,0,3,2>::type yxwz, grab, tsqp;
-                typename TProxyGenerator<1,0,3,3>::type yxww, graa, tsqq;
-                typename TProxyGenerator<1,1,0,0>::type yyxx, ggrr, ttss;
-                typename TProxyGenerator<1,1,0,1>::type yyxy, ggrg, ttst;
-                typename TProxyGenerator<1,1,0,2>::type yyxz, ggrb, ttsp;
-                typename TProxyGenerator<1,1,0,3>::type yyxw, ggra, ttsq;
-                typename TProxyGenerator<1,1,1,0>::type yyyx, gggr, ttts;
-                typename TProxyGenerator<1,1,1,1>::type yyyy, gggg, tttt;
-                typename TProxyGenerator<1,1,1,2>::type yyyz, gggb, tttp;
-                typename TProxyGenerator<1,1,1,3>::type yyyw, ggga, tttq;
-                typename TProxyGenerator<1,1,2,0>::type yyzx, ggbr, ttps;
-                typename TProxyGenerator<1,1,2,1>::type yyzy, ggbg, ttpt;
-                typename TProxyGenerator<1,1,2,2>::type yyzz, ggbb, ttpp;
-                typename TProxyGenerator<1,1,2,3>::type yyzw, ggba, ttpq;
-                typename TProxyGenerator<1,1,3,0>::type yywx, ggar, ttqs;
-                typename TProxyGenerator<1,1,3,1>::type yywy, ggag, ttqt;
-                typename TProxyGenerator<1,1,3,2>::type yywz, ggab, ttqp;
-                typename TProxyGenerator<1,1,3,3>::type yyww, ggaa, ttqq;
-                typename TProxyGenerator<1,2,0,0>::type yzxx, gbrr, tpss;
-                typename TProxyGenerator<1,2,0,1>::type yzxy, gbrg, tpst;
-                typename TProxyGenerator<1,2,0,2>::type yzxz, gbrb, tpsp;
-                typename TProxyGenerator<1,2,0,3>::type yzxw, gbra, tpsq;
-                typename TProxyGenerator<1,2,1,0>::type yzyx, gbgr, tpts;
-                typename TProxyGenerator<1,2,1,1>::type yzyy, gbgg, tptt;
-                typename TProxyGenerator<1,2,1,2>::type yzyz, gbgb, tptp;
-                typename TProxyGenerator<1,2,1,3>::type yzyw, gbga, tptq;
-                typename TProxyGenerator<1,2,2,0>::type yzzx, gbbr, tpps;
-                typename TProxyGenerator<1,2,2,1>::type yzzy, gbbg, tppt;
-                typename TProxyGenerator<1,2,2,2>::type yzzz, gbbb, tppp;
-                typename TProxyGenerator<1,2,2,3>::type yzzw, gbba, tppq;
-                typename TProxyGenerator<1,2,3,0>::type yzwx, gbar, tpqs;
-                typename TProxyGenerator<1,2,3,1>::type yzwy, gbag, tpqt;
-                typename TProxyGenerator<1,2,3,2>::type yzwz, gbab, tpqp;
-                typename TProxyGenerator<1,2,3,3>::type yzww, gbaa, tpqq;
-                typename TProxyGenerator<1,3,0,0>::type ywxx, garr, tqss;
-                typename TProxyGenerator<1,3,0,1>::type ywxy, garg, tqst;
-                typename TProxyGenerator<1,3,0,2>::type ywxz, garb, tqsp;
-                typename TProxyGenerator<1,3,0,3>::type ywxw, gara, tqsq;
-                typename TProxyGenerator<1,3,1,0>::type ywyx, gagr, tqts;
-                typename TProxyGenerator<1,3,1,1>::type ywyy, gagg, tqtt;
-                typename TProxyGenerator<1,3,1,2>::type ywyz, gagb, tqtp;
-                typename TProxyGenerator<1,3,1,3>::type ywyw, gaga, tqtq;
-                typename TProxyGenerator<1,3,2,0>::type ywzx, gabr, tqps;
-                typename TProxyGenerator<1,3,2,1>::type ywzy, gabg, tqpt;
-                typename TProxyGenerator<1,3,2,2>::type ywzz, gabb, tqpp;
-                typename TProxyGenerator<1,3,2,3>::type ywzw, gaba, tqpq;
-                typename TProxyGenerator<1,3,3,0>::type ywwx, gaar, tqqs;
-                typename TProxyGenerator<1,3,3,1>::type ywwy, gaag, tqqt;
-                typename TProxyGenerator<1,3,3,2>::type ywwz, gaab, tqqp;
-                typename TProxyGenerator<1,3,3,3>::type ywww, gaaa, tqqq;
-                typename TProxyGenerator<2,0,0,0>::type zxxx, brrr, psss;
-                typename TProxyGenerator<2,0,0,1>::type zxxy, brrg, psst;
-                typename TProxyGenerator<2,0,0,2>::type zxxz, brrb, pssp;
-                typename TProxyGenerator<2,0,0,3>::type zxxw, brra, pssq;
-                typename TProxyGenerator<2,0,1,0>::type zxyx, brgr, psts;
-                typename TProxyGenerator<2,0,1,1>::type zxyy, brgg, pstt;
-                typename TProxyGenerator<2,0,1,2>::type zxyz, brgb, pstp;
-                typename TProxyGenerator<2,0,1,3>::type zxyw, brga, pstq;
-                typename TProxyGenerator<2,0,2,0>::type zxzx, brbr, psps;
-                typename TProxyGenerator<2,0,2,1>::type zxzy, brbg, pspt;
-                typename TProxyGenerator<2,0,2,2>::type zxzz, brbb, pspp;
-                typename TProxyGenerator<2,0,2,3>::type zxzw, brba, pspq;
-                typename TProxyGenerator<2,0,3,0>::type zxwx, brar, psqs;
-                typename TProxyGenerator<2,0,3,1>::type zxwy, brag, psqt;
-                typename TProxyGenerator<2,0,3,2>::type zxwz, brab, psqp;
-                typename TProxyGenerator<2,0,3,3>::type zxww, braa, psqq;
-                typename TProxyGenerator<2,1,0,0>::type zyxx, bgrr, ptss;
-                typename TProxyGenerator<2,1,0,1>::type zyxy, bgrg, ptst;
-                typename TProxyGenerator<2,1,0,2>::type zyxz, bgrb, ptsp;
-                typename TProxyGenerator<2,1,0,3>::type zyxw, bgra, ptsq;
-                typename TProxyGenerator<2,1,1,0>::type zyyx, bggr, ptts;
-                typename TProxyGenerator<2,1,1,1>::type zyyy, bggg, pttt;
-                typename TProxyGenerator<2,1,1,2>::type zyyz, bggb, pttp;
-                typename TProxyGenerator<2,1,1,3>::type zyyw, bgga, pttq;
-                typename TProxyGenerator<2,1,2,0>::type zyzx, bgbr, ptps;
-                typename TProxyGenerator<2,1,2,1>::type zyzy, bgbg, ptpt;
-                typename TProxyGenerator<2,1,2,2>::type zyzz, bgbb, ptpp;
-                typename TProxyGenerator<2,1,2,3>::type zyzw, bgba, ptpq;
-                typename TProxyGenerator<2,1,3,0>::type zywx, bgar, ptqs;
-                typename TProxyGenerator<2,1,3,1>::type zywy, bgag, ptqt;
-                typename TProxyGenerator<2,1,3,2>::type zywz, bgab, ptqp;
-                typename TProxyGenerator<2,1,3,3>::type zyww, bgaa, ptqq;
-                typename TProxyGenerator<2,2,0,0>::type zzxx, bbrr, ppss;
-                typename TProxyGenerator<2,2,0,1>::type zzxy, bbrg, ppst;
-                typename TProxyGenerator<2,2,0,2>::type zzxz, bbrb, ppsp;
-                typename TProxyGenerator<2,2,0,3>::type zzxw, bbra, ppsq;
-                typename TProxyGenerator<2,2,1,0>::type zzyx, bbgr, ppts;
-                typename TProxyGenerator<2,2,1,1>::type zzyy, bbgg, pptt;
-                typename TProxyGenerator<2,2,1,2>::type zzyz, bbgb, pptp;
-                typename TProxyGenerator<2,2,1,3>::type zzyw, bbga, pptq;
-                typename TProxyGenerator<2,2,2,0>::type zzzx, bbbr, ppps;
-                typename TProxyGenerator<2,2,2,1>::type zzzy, bbbg, pppt;
-                typename TProxyGenerator<2,2,2,2>::type zzzz, bbbb, pppp;
-                typename TProxyGenerator<2,2,2,3>::type zzzw, bbba, pppq;
-                typename TProxyGenerator<2,2,3,0>::type zzwx, bbar, ppqs;
-                typename TProxyGenerator<2,2,3,1>::type zzwy, bbag, ppqt;
-                typename TProxyGenerator<2,2,3,2>::type zzwz, bbab, ppqp;
-                typename TProxyGenerator<2,2,3,3>::type zzww, bbaa, ppqq;
-                typename TProxyGenerator<2,3,0,0>::type zwxx, barr, pqss;
-                typename TProxyGenerator<2,3,0,1>::type zwxy, barg, pqst;
-                typename TProxyGenerator<2,3,0,2>::type zwxz, barb, pqsp;
-                typename TProxyGenerator<2,3,0,3>::type zwxw, bara, pqsq;
-                typename TProxyGenerator<2,3,1,0>::type zwyx, bagr, pqts;
-                typename TProxyGenerator<2,3,1,1>::type zwyy, bagg, pqtt;
-                typename TProxyGenerator<2,3,1,2>::type zwyz, bagb, pqtp;
-                typename TProxyGenerator<2,3,1,3>::type zwyw, baga, pqtq;
-                typename TProxyGenerator<2,3,2,0>::type zwzx, babr, pqps;
-                typename TProxyGenerator<2,3,2,1>::type zwzy, babg, pqpt;
-                typename TProxyGenerator<2,3,2,2>::type zwzz, babb, pqpp;
-                typename TProxyGenerator<2,3,2,3>::type zwzw, baba, pqpq;
-                typename TProxyGenerator<2,3,3,0>::type zwwx, baar, pqqs;
-                typename TProxyGenerator<2,3,3,1>::type zwwy, baag, pqqt;
-                typename TProxyGenerator<2,3,3,2>::type zwwz, baab, pqqp;
-                typename TProxyGenerator<2,3,3,3>::type zwww, baaa, pqqq;
-                typename TProxyGenerator<3,0,0,0>::type wxxx, arrr, qsss;
-                typename TProxyGenerator<3,0,0,1>::type wxxy, arrg, qsst;
-                typename TProxyGenerator<3,0,0,2>::type wxxz, arrb, qssp;
-                typename TProxyGenerator<3,0,0,3>::type wxxw, arra, qssq;
-                typename TProxyGenerator<3,0,1,0>::type wxyx, argr, qsts;
-                typename TProxyGenerator<3,0,1,1>::type wxyy, argg, qstt;
-                typename TProxyGenerator<3,0,1,2>::type wxyz, argb, qstp;
-                typename TProxyGenerator<3,0,1,3>::type wxyw, arga, qstq;
-                typename TProxyGenerator<3,0,2,0>::type wxzx, arbr, qsps;
-                typename TProxyGenerator<3,0,2,1>::type wxzy, arbg, qspt;
-                typename TProxyGenerator<3,0,2,2>::type wxzz, arbb, qspp;
-                typename TProxyGenerator<3,0,2,3>::type wxzw, arba, qspq;
-                typename TProxyGenerator<3,0,3,0>::type wxwx, arar, qsqs;
-                typename TProxyGenerator<3,0,3,1>::type wxwy, arag, qsqt;
-                typename TProxyGenerator<3,0,3,2>::type wxwz, arab, qsqp;
-                typename TProxyGenerator<3,0,3,3>::type wxww, araa, qsqq;
-                typename TProxyGenerator<3,1,0,0>::type wyxx, agrr, qtss;
-                typename TProxyGenerator<3,1,0,1>::type wyxy, agrg, qtst;
-                typename TProxyGenerator<3,1,0,2>::type wyxz, agrb, qtsp;
-                typename TProxyGenerator<3,1,0,3>::type wyxw, agra, qtsq;
-                typename TProxyGenerator<3,1,1,0>::type wyyx, aggr, qtts;
-                typename TProxyGenerator<3,1,1,1>::type wyyy, aggg, qttt;
-                typename TProxyGenerator<3,1,1,2>::type wyyz, aggb, qttp;
-                typename TProxyGenerator<3,1,1,3>::type wyyw, agga, qttq;
-                typename TProxyGenerator<3,1,2,0>::type wyzx, agbr, qtps;
-                typename TProxyGenerator<3,1,2,1>::type wyzy, agbg, qtpt;
-                typename TProxyGenerator<3,1,2,2>::type wyzz, agbb, qtpp;
-                typename TProxyGenerator<3,1,2,3>::type wyzw, agba, qtpq;
-                typename TProxyGenerator<3,1,3,0>::type wywx, agar, qtqs;
-                typename TProxyGenerator<3,1,3,1>::type wywy, agag, qtqt;
-                typename TProxyGenerator<3,1,3,2>::type wywz, agab, qtqp;
-                typename TProxyGenerator<3,1,3,3>::type wyww, agaa, qtqq;
-                typename TProxyGenerator<3,2,0,0>::type wzxx, abrr, qpss;
-                typename TProxyGenerator<3,2,0,1>::type wzxy, abrg, qpst;
-                typename TProxyGenerator<3,2,0,2>::type wzxz, abrb, qpsp;
-                typename TProxyGenerator<3,2,0,3>::type wzxw, abra, qpsq;
-                typename TProxyGenerator<3,2,1,0>::type wzyx, abgr, qpts;
-                typename TProxyGenerator<3,2,1,1>::type wzyy, abgg, qptt;
-                typename TProxyGenerator<3,2,1,2>::type wzyz, abgb, qptp;
-                typename TProxyGenerator<3,2,1,3>::type wzyw, abga, qptq;
-                typename TProxyGenerator<3,2,2,0>::type wzzx, abbr, qpps;
-                typename TProxyGenerator<3,2,2,1>::type wzzy, abbg, qppt;
-                typename TProxyGenerator<3,2,2,2>::type wzzz, abbb, qppp;
-                typename TProxyGenerator<3,2,2,3>::type wzzw, abba, qppq;
-                typename TProxyGenerator<3,2,3,0>::type wzwx, abar, qpqs;
-                typename TProxyGenerator<3,2,3,1>::type wzwy, abag, qpqt;
-                typename TProxyGenerator<3,2,3,2>::type wzwz, abab, qpqp;
-                typename TProxyGenerator<3,2,3,3>::type wzww, abaa, qpqq;
-                typename TProxyGenerator<3,3,0,0>::type wwxx, aarr, qqss;
-                typename TProxyGenerator<3,3,0,1>::type wwxy, aarg, qqst;
-                typename TProxyGenerator<3,3,0,2>::type wwxz, aarb, qqsp;
-                typename TProxyGenerator<3,3,0,3>::type wwxw, aara, qqsq;
-                typename TProxyGenerator<3,3,1,0>::type wwyx, aagr, qqts;
-                typename TProxyGenerator<3,3,1,1>::type wwyy, aagg, qqtt;
-                typename TProxyGenerator<3,3,1,2>::type wwyz, aagb, qqtp;
-                typename TProxyGenerator<3,3,1,3>::type wwyw, aaga, qqtq;
-                typename TProxyGenerator<3,3,2,0>::type wwzx, aabr, qqps;
-                typename TProxyGenerator<3,3,2,1>::type wwzy, aabg, qqpt;
-                typename TProxyGenerator<3,3,2,2>::type wwzz, aabb, qqpp;
-                typename TProxyGenerator<3,3,2,3>::type wwzw, aaba, qqpq;
-                typename TProxyGenerator<3,3,3,0>::type wwwx, aaar, qqqs;
-                typename TProxyGenerator<3,3,3,1>::type wwwy, aaag, qqqt;
-                typename TProxyGenerator<3,3,3,2>::type wwwz, aaab, qqqp;
-                typename TProxyGenerator<3,3,3,3>::type wwww, aaaa, qqqq;
+                CXXSWIZZLE_DETAIL_SWIZZLE2(0, 0, xx, rr, ss)
+                CXXSWIZZLE_DETAIL_SWIZZLE2(0, 1, xy, rg, st)
+                CXXSWIZZLE_DETAIL_SWIZZLE2(0, 2, xz, rb, sp)
+                CXXSWIZZLE_DETAIL_SWIZZLE2(0, 3, xw, ra, sq)
+                CXXSWIZZLE_DETAIL_SWIZZLE2(1, 0, yx, gr, ts)
+                CXXSWIZZLE_DETAIL_SWIZZLE2(1, 1, yy, gg, tt)
+                CXXSWIZZLE_DETAIL_SWIZZLE2(1, 2, yz, gb, tp)
+                CXXSWIZZLE_DETAIL_SWIZZLE2(1, 3, yw, ga, tq)
+                CXXSWIZZLE_DETAIL_SWIZZLE2(2, 0, zx, br, ps)
+                CXXSWIZZLE_DETAIL_SWIZZLE2(2, 1, zy, bg, pt)
+                CXXSWIZZLE_DETAIL_SWIZZLE2(2, 2, zz, bb, pp)
+                CXXSWIZZLE_DETAIL_SWIZZLE2(2, 3, zw, ba, pq)
+                CXXSWIZZLE_DETAIL_SWIZZLE2(3, 0, wx, ar, qs)
+                CXXSWIZZLE_DETAIL_SWIZZLE2(3, 1, wy, ag, qt)
+                CXXSWIZZLE_DETAIL_SWIZZLE2(3, 2, wz, ab, qp)
+                CXXSWIZZLE_DETAIL_SWIZZLE2(3, 3, ww, aa, qq)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(0, 0, 0, xxx, rrr, sss)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(0, 0, 1, xxy, rrg, sst)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(0, 0, 2, xxz, rrb, ssp)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(0, 0, 3, xxw, rra, ssq)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(0, 1, 0, xyx, rgr, sts)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(0, 1, 1, xyy, rgg, stt)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(0, 1, 2, xyz, rgb, stp)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(0, 1, 3, xyw, rga, stq)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(0, 2, 0, xzx, rbr, sps)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(0, 2, 1, xzy, rbg, spt)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(0, 2, 2, xzz, rbb, spp)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(0, 2, 3, xzw, rba, spq)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(0, 3, 0, xwx, rar, sqs)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(0, 3, 1, xwy, rag, sqt)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(0, 3, 2, xwz, rab, sqp)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(0, 3, 3, xww, raa, sqq)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(1, 0, 0, yxx, grr, tss)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(1, 0, 1, yxy, grg, tst)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(1, 0, 2, yxz, grb, tsp)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(1, 0, 3, yxw, gra, tsq)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(1, 1, 0, yyx, ggr, tts)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(1, 1, 1, yyy, ggg, ttt)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(1, 1, 2, yyz, ggb, ttp)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(1, 1, 3, yyw, gga, ttq)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(1, 2, 0, yzx, gbr, tps)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(1, 2, 1, yzy, gbg, tpt)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(1, 2, 2, yzz, gbb, tpp)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(1, 2, 3, yzw, gba, tpq)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(1, 3, 0, ywx, gar, tqs)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(1, 3, 1, ywy, gag, tqt)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(1, 3, 2, ywz, gab, tqp)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(1, 3, 3, yww, gaa, tqq)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(2, 0, 0, zxx, brr, pss)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(2, 0, 1, zxy, brg, pst)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(2, 0, 2, zxz, brb, psp)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(2, 0, 3, zxw, bra, psq)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(2, 1, 0, zyx, bgr, pts)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(2, 1, 1, zyy, bgg, ptt)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(2, 1, 2, zyz, bgb, ptp)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(2, 1, 3, zyw, bga, ptq)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(2, 2, 0, zzx, bbr, pps)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(2, 2, 1, zzy, bbg, ppt)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(2, 2, 2, zzz, bbb, ppp)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(2, 2, 3, zzw, bba, ppq)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(2, 3, 0, zwx, bar, pqs)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(2, 3, 1, zwy, bag, pqt)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(2, 3, 2, zwz, bab, pqp)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(2, 3, 3, zww, baa, pqq)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(3, 0, 0, wxx, arr, qss)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(3, 0, 1, wxy, arg, qst)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(3, 0, 2, wxz, arb, qsp)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(3, 0, 3, wxw, ara, qsq)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(3, 1, 0, wyx, agr, qts)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(3, 1, 1, wyy, agg, qtt)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(3, 1, 2, wyz, agb, qtp)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(3, 1, 3, wyw, aga, qtq)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(3, 2, 0, wzx, abr, qps)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(3, 2, 1, wzy, abg, qpt)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(3, 2, 2, wzz, abb, qpp)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(3, 2, 3, wzw, aba, qpq)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(3, 3, 0, wwx, aar, qqs)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(3, 3, 1, wwy, aag, qqt)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(3, 3, 2, wwz, aab, qqp)
+                CXXSWIZZLE_DETAIL_SWIZZLE3(3, 3, 3, www, aaa, qqq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 0, 0, 0, xxxx, rrrr, ssss)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 0, 0, 1, xxxy, rrrg, ssst)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 0, 0, 2, xxxz, rrrb, sssp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 0, 0, 3, xxxw, rrra, sssq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 0, 1, 0, xxyx, rrgr, ssts)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 0, 1, 1, xxyy, rrgg, sstt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 0, 1, 2, xxyz, rrgb, sstp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 0, 1, 3, xxyw, rrga, sstq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 0, 2, 0, xxzx, rrbr, ssps)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 0, 2, 1, xxzy, rrbg, sspt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 0, 2, 2, xxzz, rrbb, sspp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 0, 2, 3, xxzw, rrba, sspq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 0, 3, 0, xxwx, rrar, ssqs)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 0, 3, 1, xxwy, rrag, ssqt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 0, 3, 2, xxwz, rrab, ssqp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 0, 3, 3, xxww, rraa, ssqq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 1, 0, 0, xyxx, rgrr, stss)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 1, 0, 1, xyxy, rgrg, stst)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 1, 0, 2, xyxz, rgrb, stsp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 1, 0, 3, xyxw, rgra, stsq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 1, 1, 0, xyyx, rggr, stts)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 1, 1, 1, xyyy, rggg, sttt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 1, 1, 2, xyyz, rggb, sttp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 1, 1, 3, xyyw, rgga, sttq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 1, 2, 0, xyzx, rgbr, stps)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 1, 2, 1, xyzy, rgbg, stpt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 1, 2, 2, xyzz, rgbb, stpp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 1, 2, 3, xyzw, rgba, stpq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 1, 3, 0, xywx, rgar, stqs)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 1, 3, 1, xywy, rgag, stqt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 1, 3, 2, xywz, rgab, stqp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 1, 3, 3, xyww, rgaa, stqq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 2, 0, 0, xzxx, rbrr, spss)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 2, 0, 1, xzxy, rbrg, spst)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 2, 0, 2, xzxz, rbrb, spsp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 2, 0, 3, xzxw, rbra, spsq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 2, 1, 0, xzyx, rbgr, spts)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 2, 1, 1, xzyy, rbgg, sptt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 2, 1, 2, xzyz, rbgb, sptp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 2, 1, 3, xzyw, rbga, sptq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 2, 2, 0, xzzx, rbbr, spps)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 2, 2, 1, xzzy, rbbg, sppt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 2, 2, 2, xzzz, rbbb, sppp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 2, 2, 3, xzzw, rbba, sppq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 2, 3, 0, xzwx, rbar, spqs)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 2, 3, 1, xzwy, rbag, spqt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 2, 3, 2, xzwz, rbab, spqp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 2, 3, 3, xzww, rbaa, spqq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 3, 0, 0, xwxx, rarr, sqss)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 3, 0, 1, xwxy, rarg, sqst)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 3, 0, 2, xwxz, rarb, sqsp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 3, 0, 3, xwxw, rara, sqsq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 3, 1, 0, xwyx, ragr, sqts)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 3, 1, 1, xwyy, ragg, sqtt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 3, 1, 2, xwyz, ragb, sqtp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 3, 1, 3, xwyw, raga, sqtq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 3, 2, 0, xwzx, rabr, sqps)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 3, 2, 1, xwzy, rabg, sqpt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 3, 2, 2, xwzz, rabb, sqpp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 3, 2, 3, xwzw, raba, sqpq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 3, 3, 0, xwwx, raar, sqqs)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 3, 3, 1, xwwy, raag, sqqt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 3, 3, 2, xwwz, raab, sqqp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(0, 3, 3, 3, xwww, raaa, sqqq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 0, 0, 0, yxxx, grrr, tsss)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 0, 0, 1, yxxy, grrg, tsst)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 0, 0, 2, yxxz, grrb, tssp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 0, 0, 3, yxxw, grra, tssq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 0, 1, 0, yxyx, grgr, tsts)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 0, 1, 1, yxyy, grgg, tstt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 0, 1, 2, yxyz, grgb, tstp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 0, 1, 3, yxyw, grga, tstq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 0, 2, 0, yxzx, grbr, tsps)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 0, 2, 1, yxzy, grbg, tspt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 0, 2, 2, yxzz, grbb, tspp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 0, 2, 3, yxzw, grba, tspq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 0, 3, 0, yxwx, grar, tsqs)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 0, 3, 1, yxwy, grag, tsqt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 0, 3, 2, yxwz, grab, tsqp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 0, 3, 3, yxww, graa, tsqq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 1, 0, 0, yyxx, ggrr, ttss)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 1, 0, 1, yyxy, ggrg, ttst)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 1, 0, 2, yyxz, ggrb, ttsp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 1, 0, 3, yyxw, ggra, ttsq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 1, 1, 0, yyyx, gggr, ttts)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 1, 1, 1, yyyy, gggg, tttt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 1, 1, 2, yyyz, gggb, tttp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 1, 1, 3, yyyw, ggga, tttq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 1, 2, 0, yyzx, ggbr, ttps)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 1, 2, 1, yyzy, ggbg, ttpt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 1, 2, 2, yyzz, ggbb, ttpp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 1, 2, 3, yyzw, ggba, ttpq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 1, 3, 0, yywx, ggar, ttqs)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 1, 3, 1, yywy, ggag, ttqt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 1, 3, 2, yywz, ggab, ttqp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 1, 3, 3, yyww, ggaa, ttqq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 2, 0, 0, yzxx, gbrr, tpss)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 2, 0, 1, yzxy, gbrg, tpst)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 2, 0, 2, yzxz, gbrb, tpsp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 2, 0, 3, yzxw, gbra, tpsq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 2, 1, 0, yzyx, gbgr, tpts)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 2, 1, 1, yzyy, gbgg, tptt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 2, 1, 2, yzyz, gbgb, tptp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 2, 1, 3, yzyw, gbga, tptq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 2, 2, 0, yzzx, gbbr, tpps)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 2, 2, 1, yzzy, gbbg, tppt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 2, 2, 2, yzzz, gbbb, tppp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 2, 2, 3, yzzw, gbba, tppq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 2, 3, 0, yzwx, gbar, tpqs)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 2, 3, 1, yzwy, gbag, tpqt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 2, 3, 2, yzwz, gbab, tpqp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 2, 3, 3, yzww, gbaa, tpqq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 3, 0, 0, ywxx, garr, tqss)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 3, 0, 1, ywxy, garg, tqst)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 3, 0, 2, ywxz, garb, tqsp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 3, 0, 3, ywxw, gara, tqsq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 3, 1, 0, ywyx, gagr, tqts)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 3, 1, 1, ywyy, gagg, tqtt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 3, 1, 2, ywyz, gagb, tqtp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 3, 1, 3, ywyw, gaga, tqtq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 3, 2, 0, ywzx, gabr, tqps)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 3, 2, 1, ywzy, gabg, tqpt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 3, 2, 2, ywzz, gabb, tqpp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 3, 2, 3, ywzw, gaba, tqpq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 3, 3, 0, ywwx, gaar, tqqs)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 3, 3, 1, ywwy, gaag, tqqt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 3, 3, 2, ywwz, gaab, tqqp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(1, 3, 3, 3, ywww, gaaa, tqqq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 0, 0, 0, zxxx, brrr, psss)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 0, 0, 1, zxxy, brrg, psst)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 0, 0, 2, zxxz, brrb, pssp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 0, 0, 3, zxxw, brra, pssq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 0, 1, 0, zxyx, brgr, psts)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 0, 1, 1, zxyy, brgg, pstt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 0, 1, 2, zxyz, brgb, pstp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 0, 1, 3, zxyw, brga, pstq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 0, 2, 0, zxzx, brbr, psps)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 0, 2, 1, zxzy, brbg, pspt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 0, 2, 2, zxzz, brbb, pspp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 0, 2, 3, zxzw, brba, pspq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 0, 3, 0, zxwx, brar, psqs)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 0, 3, 1, zxwy, brag, psqt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 0, 3, 2, zxwz, brab, psqp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 0, 3, 3, zxww, braa, psqq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 1, 0, 0, zyxx, bgrr, ptss)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 1, 0, 1, zyxy, bgrg, ptst)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 1, 0, 2, zyxz, bgrb, ptsp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 1, 0, 3, zyxw, bgra, ptsq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 1, 1, 0, zyyx, bggr, ptts)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 1, 1, 1, zyyy, bggg, pttt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 1, 1, 2, zyyz, bggb, pttp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 1, 1, 3, zyyw, bgga, pttq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 1, 2, 0, zyzx, bgbr, ptps)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 1, 2, 1, zyzy, bgbg, ptpt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 1, 2, 2, zyzz, bgbb, ptpp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 1, 2, 3, zyzw, bgba, ptpq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 1, 3, 0, zywx, bgar, ptqs)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 1, 3, 1, zywy, bgag, ptqt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 1, 3, 2, zywz, bgab, ptqp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 1, 3, 3, zyww, bgaa, ptqq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 2, 0, 0, zzxx, bbrr, ppss)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 2, 0, 1, zzxy, bbrg, ppst)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 2, 0, 2, zzxz, bbrb, ppsp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 2, 0, 3, zzxw, bbra, ppsq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 2, 1, 0, zzyx, bbgr, ppts)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 2, 1, 1, zzyy, bbgg, pptt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 2, 1, 2, zzyz, bbgb, pptp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 2, 1, 3, zzyw, bbga, pptq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 2, 2, 0, zzzx, bbbr, ppps)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 2, 2, 1, zzzy, bbbg, pppt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 2, 2, 2, zzzz, bbbb, pppp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 2, 2, 3, zzzw, bbba, pppq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 2, 3, 0, zzwx, bbar, ppqs)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 2, 3, 1, zzwy, bbag, ppqt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 2, 3, 2, zzwz, bbab, ppqp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 2, 3, 3, zzww, bbaa, ppqq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 3, 0, 0, zwxx, barr, pqss)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 3, 0, 1, zwxy, barg, pqst)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 3, 0, 2, zwxz, barb, pqsp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 3, 0, 3, zwxw, bara, pqsq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 3, 1, 0, zwyx, bagr, pqts)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 3, 1, 1, zwyy, bagg, pqtt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 3, 1, 2, zwyz, bagb, pqtp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 3, 1, 3, zwyw, baga, pqtq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 3, 2, 0, zwzx, babr, pqps)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 3, 2, 1, zwzy, babg, pqpt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 3, 2, 2, zwzz, babb, pqpp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 3, 2, 3, zwzw, baba, pqpq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 3, 3, 0, zwwx, baar, pqqs)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 3, 3, 1, zwwy, baag, pqqt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 3, 3, 2, zwwz, baab, pqqp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(2, 3, 3, 3, zwww, baaa, pqqq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 0, 0, 0, wxxx, arrr, qsss)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 0, 0, 1, wxxy, arrg, qsst)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 0, 0, 2, wxxz, arrb, qssp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 0, 0, 3, wxxw, arra, qssq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 0, 1, 0, wxyx, argr, qsts)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 0, 1, 1, wxyy, argg, qstt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 0, 1, 2, wxyz, argb, qstp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 0, 1, 3, wxyw, arga, qstq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 0, 2, 0, wxzx, arbr, qsps)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 0, 2, 1, wxzy, arbg, qspt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 0, 2, 2, wxzz, arbb, qspp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 0, 2, 3, wxzw, arba, qspq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 0, 3, 0, wxwx, arar, qsqs)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 0, 3, 1, wxwy, arag, qsqt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 0, 3, 2, wxwz, arab, qsqp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 0, 3, 3, wxww, araa, qsqq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 1, 0, 0, wyxx, agrr, qtss)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 1, 0, 1, wyxy, agrg, qtst)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 1, 0, 2, wyxz, agrb, qtsp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 1, 0, 3, wyxw, agra, qtsq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 1, 1, 0, wyyx, aggr, qtts)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 1, 1, 1, wyyy, aggg, qttt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 1, 1, 2, wyyz, aggb, qttp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 1, 1, 3, wyyw, agga, qttq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 1, 2, 0, wyzx, agbr, qtps)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 1, 2, 1, wyzy, agbg, qtpt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 1, 2, 2, wyzz, agbb, qtpp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 1, 2, 3, wyzw, agba, qtpq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 1, 3, 0, wywx, agar, qtqs)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 1, 3, 1, wywy, agag, qtqt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 1, 3, 2, wywz, agab, qtqp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 1, 3, 3, wyww, agaa, qtqq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 2, 0, 0, wzxx, abrr, qpss)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 2, 0, 1, wzxy, abrg, qpst)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 2, 0, 2, wzxz, abrb, qpsp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 2, 0, 3, wzxw, abra, qpsq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 2, 1, 0, wzyx, abgr, qpts)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 2, 1, 1, wzyy, abgg, qptt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 2, 1, 2, wzyz, abgb, qptp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 2, 1, 3, wzyw, abga, qptq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 2, 2, 0, wzzx, abbr, qpps)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 2, 2, 1, wzzy, abbg, qppt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 2, 2, 2, wzzz, abbb, qppp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 2, 2, 3, wzzw, abba, qppq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 2, 3, 0, wzwx, abar, qpqs)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 2, 3, 1, wzwy, abag, qpqt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 2, 3, 2, wzwz, abab, qpqp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 2, 3, 3, wzww, abaa, qpqq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 3, 0, 0, wwxx, aarr, qqss)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 3, 0, 1, wwxy, aarg, qqst)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 3, 0, 2, wwxz, aarb, qqsp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 3, 0, 3, wwxw, aara, qqsq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 3, 1, 0, wwyx, aagr, qqts)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 3, 1, 1, wwyy, aagg, qqtt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 3, 1, 2, wwyz, aagb, qqtp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 3, 1, 3, wwyw, aaga, qqtq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 3, 2, 0, wwzx, aabr, qqps)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 3, 2, 1, wwzy, aabg, qqpt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 3, 2, 2, wwzz, aabb, qqpp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 3, 2, 3, wwzw, aaba, qqpq)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 3, 3, 0, wwwx, aaar, qqqs)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 3, 3, 1, wwwy, aaag, qqqt)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 3, 3, 2, wwwz, aaab, qqqp)
+                CXXSWIZZLE_DETAIL_SWIZZLE4(3, 3, 3, 3, wwww, aaaa, qqqq)
             };
         };
     }
-}
\ No newline at end of file
+}
+
+#undef CXXSWIZZLE_DETAIL_SWIZZLE4
+#undef CXXSWIZZLE_DETAIL_SWIZZLE3
+#undef CXXSWIZZLE_DETAIL_SWIZZLE2
+#undef CXXSWIZZLE_DETAIL_SWIZZLE
+#undef CXXSWIZZLE_DETAIL_STPQ
+#undef CXXSWIZZLE_DETAIL_RGBA
@@ -5,43 +5,70 @@
 #include <type_traits>
 #include <swizzle/detail/utils.h>
 #include <swizzle/detail/vector_traits.h>
-#include <functional>
 
 namespace swizzle
 {
     namespace detail
     {
-        //! A wrapper for a vector reference. Makes inout and out parameters work with proxies, but at a cost
-        //! of std::function call (and likely an alloc, too).
+        //! A wrapper for a vector reference. Makes inout and out parameters work with proxies: it holds a copy
+        //! of the value and writes it back to the target on destruction. The target's type is only known
+        //! to the write back function, so there's no allocation involved, just an indirect call.
         template <class VectorType>
         struct vector_inout_wrapper : public VectorType
         {
             typedef VectorType vector_type;
 
         private:
-            std::function<void(const vector_type&)> m_cleanup;
+            typedef void (*write_back_func)(void* target, const vector_type& value);
+
+            void* m_target;
+            write_back_func m_writeBack;
+
+            template <class TargetType>
+            static void write_back(void* target, const vector_type& value)
+            {
+                *static_cast<TargetType*>(target) = value;
+            }
 
         public:
 
             vector_inout_wrapper(vector_type& value)
                 : vector_type(value)
-            {
-                m_cleanup = [&](const vector_type& v) -> void { value = v; };
-            }
+                , m_target(&value)
+                , m_writeBack(&write_back<vector_type>)
+            {}
 
-            vector_inout_wrapper(const vector_type& value, std::function<void(const vector_type&)> cleanup)
+            //! Target is anything the vector can be assigned to, e.g. a proxy.
+            template <class TargetType>
+            vector_inout_wrapper(const vector_type& value, TargetType& target)
                 : vector_type(value)
-                , m_cleanup(cleanup)
+                , m_target(&target)
+                , m_writeBack(&write_back<TargetType>)
+            {}
+
+            //! The moved from wrapper doesn't write back.
+            vector_inout_wrapper(vector_inout_wrapper&& other)
+                : vector_type(other)
+                , m_target(other.m_target)
+                , m_writeBack(other.m_writeBack)
             {
+                other.m_writeBack = nullptr;
             }
 
             ~vector_inout_wrapper()
             {
-                if (m_cleanup)
+                if (m_writeBack)
                 {
-                    m_cleanup(*this);
+                    m_writeBack(m_target, *this);
                 }
             }
+
+            using vector_type::operator=;
+
+        private:
+            // copies would write back more than once
+            vector_inout_wrapper(const vector_inout_wrapper&);
+            vector_inout_wrapper& operator=(const vector_inout_wrapper&);
         };
 
         template <class TVector>
@@ -50,4 +77,4 @@ namespace swizzle
             typedef TVector type;
         };
     }
-}
\ No newline at end of file
+}
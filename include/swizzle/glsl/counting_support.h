@@ -0,0 +1,52 @@
+// CxxSwizzle
+// Copyright (c) 2013-2015, Piotr Gwiazdowski <gwiazdorrr+github at gmail.com>
+#pragma once
+
+#include <array>
+#include <swizzle/detail/primitive_wrapper.h>
+#include <swizzle/detail/counting_scalar.h>
+#include <swizzle/glsl/vector_helper.h>
+
+
+namespace swizzle
+{
+    namespace glsl
+    {
+        //! A float that counts every operation done on it (see detail::op_counters). Slow, but
+        //! deterministic and hardware independent measure of a shader cost.
+        typedef detail::primitive_wrapper < detail::counting_scalar<float>, float, bool, detail::counting_assign_policy > counting_float;
+
+
+        //! Specialise vector_helper so that it knows what to do.
+        template <size_t Size>
+        struct vector_helper<counting_float, Size>
+        {
+            typedef std::array<counting_float::internal_type, Size> data_type;
+
+            template <size_t... indices>
+            struct proxy_generator
+            {
+                typedef detail::indexed_proxy< vector<counting_float, sizeof...(indices)>, data_type, indices...> type;
+            };
+
+            //! A factory of 1-component proxies.
+            template <size_t x>
+            struct proxy_generator<x>
+            {
+                typedef counting_float type;
+            };
+
+            typedef detail::vector_base< Size, proxy_generator, data_type > base_type;
+        };
+    }
+
+    namespace detail
+    {
+        //! CxxSwizzle needs to know which vector to create if it needs to
+        template <>
+        struct get_vector_type_impl< ::swizzle::glsl::counting_float >
+        {
+            typedef ::swizzle::glsl::vector<::swizzle::glsl::counting_float, 1> type;
+        };
+    }
+}
@@ -0,0 +1,65 @@
+// CxxSwizzle
+// Copyright (c) 2013-2015, Piotr Gwiazdowski <gwiazdorrr+github at gmail.com>
+#pragma once
+
+#include <atomic>
+#include <mutex>
+
+namespace swizzle
+{
+    namespace glsl
+    {
+        //! Counts changes of uniforms; whoever sets them calls next(), while no shader is running.
+        struct uniform_generation
+        {
+            static std::atomic<unsigned>& current()
+            {
+                static std::atomic<unsigned> s_generation(1);
+                return s_generation;
+            }
+
+            static void next()
+            {
+                ++current();
+            }
+        };
+
+        //! A value derived from uniforms only (e.g. a camera matrix), computed once per uniform
+        //! generation rather than for each pixel. The first thread to need it in a generation computes
+        //! it, others wait and then share it read only. Meant to be a static local of a shader, hence
+        //! the function computing the value is given at each use and may refer to other locals.
+        template <class T>
+        class frame_constant
+        {
+        public:
+            frame_constant()
+                : m_generation(0)
+            {}
+
+            template <class Func>
+            const T& get(Func&& compute)
+            {
+                unsigned generation = uniform_generation::current().load(std::memory_order_relaxed);
+                if ( m_generation.load(std::memory_order_acquire) != generation )
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    if ( m_generation.load(std::memory_order_relaxed) != generation )
+                    {
+                        m_value = compute();
+                        m_generation.store(generation, std::memory_order_release);
+                    }
+                }
+                return m_value;
+            }
+
+        private:
+            T m_value;
+            std::atomic<unsigned> m_generation;
+            std::mutex m_mutex;
+
+            // do not allow copies to be made
+            frame_constant(const frame_constant&);
+            frame_constant& operator=(const frame_constant&);
+        };
+    }
+}
@@ -0,0 +1,65 @@
+// CxxSwizzle
+// Copyright (c) 2013-2015, Piotr Gwiazdowski <gwiazdorrr+github at gmail.com>
+#pragma once
+
+// Explicit instantiations of the common vector and matrix types: vec2-4 and mat2-4 of float, double,
+// int and, if Vc is included, vc_float. The instantiations library (see instantiations/) compiles the
+// definitions once; a translation unit defining CXXSWIZZLE_EXTERN_TEMPLATES before including this
+// gets extern declarations instead, so that it doesn't emit out-of-line copies of the members (they
+// still get inlined). Both sides need to be built with the same configuration macros; a mismatch
+// fails to link (see CXXSWIZZLE_CONFIGURATION_CHECK).
+
+#include <swizzle/glsl/vector.h>
+#include <swizzle/glsl/matrix.h>
+
+#if defined(VC_VERSION_NUMBER)
+#include <swizzle/glsl/simd_support_vc.h>
+#endif
+
+//! Instantiation definitions or, if prefix is extern, declarations of vec2-4 of the scalar type.
+#define CXXSWIZZLE_INSTANTIATE_VECTORS(prefix, scalar) \
+    prefix template class ::swizzle::glsl::vector<scalar, 2>; \
+    prefix template class ::swizzle::glsl::vector<scalar, 3>; \
+    prefix template class ::swizzle::glsl::vector<scalar, 4>;
+
+//! Instantiation definitions or, if prefix is extern, declarations of mat2-4 of the scalar type.
+#define CXXSWIZZLE_INSTANTIATE_MATRICES(prefix, scalar) \
+    prefix template class ::swizzle::glsl::matrix< ::swizzle::glsl::vector, scalar, 2, 2>; \
+    prefix template class ::swizzle::glsl::matrix< ::swizzle::glsl::vector, scalar, 3, 3>; \
+    prefix template class ::swizzle::glsl::matrix< ::swizzle::glsl::vector, scalar, 4, 4>;
+
+#define CXXSWIZZLE_INSTANTIATE(prefix, scalar) \
+    CXXSWIZZLE_INSTANTIATE_VECTORS(prefix, scalar) \
+    CXXSWIZZLE_INSTANTIATE_MATRICES(prefix, scalar)
+
+#ifdef CXXSWIZZLE_VECTOR_INOUT_WRAPPER_ENABLED
+#define CXXSWIZZLE_DETAIL_INOUT_WRAPPER 1
+#else
+#define CXXSWIZZLE_DETAIL_INOUT_WRAPPER 0
+#endif
+
+#define CXXSWIZZLE_DETAIL_CONFIGURATION_NAME_IMPL(byValue, rgba, stpq, length, inout) \
+    instantiations_configuration_by_value_##byValue##_rgba_##rgba##_stpq_##stpq##_length_##length##_inout_##inout
+#define CXXSWIZZLE_DETAIL_CONFIGURATION_NAME(byValue, rgba, stpq, length, inout) \
+    CXXSWIZZLE_DETAIL_CONFIGURATION_NAME_IMPL(byValue, rgba, stpq, length, inout)
+
+//! Function the instantiations library defines, named after the configuration macros affecting layout
+//! and members of vectors (these need to be plain numbers); translation units declaring the types
+//! extern call it, so using a library built with different ones is an undefined reference.
+#define CXXSWIZZLE_CONFIGURATION_CHECK CXXSWIZZLE_DETAIL_CONFIGURATION_NAME(CXXSWIZZLE_PASS_BY_VALUE, \
+    CXXSWIZZLE_SWIZZLE_RGBA, CXXSWIZZLE_SWIZZLE_STPQ, CXXSWIZZLE_MAX_SWIZZLE_LENGTH, CXXSWIZZLE_DETAIL_INOUT_WRAPPER)
+
+namespace swizzle
+{
+    namespace detail
+    {
+        void CXXSWIZZLE_CONFIGURATION_CHECK();
+
+#if defined(CXXSWIZZLE_EXTERN_TEMPLATES)
+        namespace
+        {
+            const bool c_instantiationsConfigurationChecked = (CXXSWIZZLE_CONFIGURATION_CHECK(), true);
+        }
+#endif
+    }
+}
@@ -29,18 +29,32 @@ namespace swizzle
             static const size_t n_dimension = N;
             static const size_t m_dimension = M;
 
+        private:
+            //! Can the matrix be constant-initialised from these? Only from N*M arithmetic values
+            //! and only if its scalars are arithmetic too.
+            template <class T0, class... T>
+            struct is_literal_construction : std::integral_constant<bool, sizeof...(T) + 1 == N * M && std::is_arithmetic<scalar_type>::value &&
+                detail::all<std::is_arithmetic, typename detail::remove_reference_cv<T0>::type, typename detail::remove_reference_cv<T>::type...>::value>
+            {};
+
+            //! Values of a literal construction, column by column.
+            struct literal_values
+            {
+                scalar_type values[N * M];
+            };
+
         // CONSTRUCTION
         public:
 
             //! Default zeroing constructor.
-            matrix()
+            CXXSWIZZLE_CONSTEXPR matrix()
+                : m_data()
             {}
 
             //! Copying constructor
-            matrix(const matrix& other)
-            {
-                m_data = other.m_data;
-            }
+            CXXSWIZZLE_CONSTEXPR matrix(const matrix& other)
+                : m_data(other.m_data)
+            {}
 
             //! Constructor for matrices smaller than current one
             template <size_t OtherM, size_t OtherN>
@@ -51,12 +65,10 @@ namespace swizzle
 
                 detail::static_for<0, min_n>([&](size_t row) -> void 
                 {
-                    // static_for kills compilers over here...
-                    // detail::static_for<0, min_m>([&](size_t col) -> void 
-                    for (size_t col = 0; col < min_m; ++col)
+                    detail::static_for<0, min_m>([&](size_t col) -> void
                     {
                         cell(row, col) = other.cell(row, col);
-                    }
+                    });
                 });
 
                 // fill rest with 1s
@@ -72,8 +84,15 @@ namespace swizzle
                 detail::static_for<0, min_dim>([&](size_t i) -> void { m_data[i][i] = s; });
             }
 
+            //! Constructor from N*M arithmetic values, usable in constant expressions.
+            template <class T0, class... T, class = typename std::enable_if<is_literal_construction<T0, T...>::value>::type>
+            CXXSWIZZLE_CONSTEXPR explicit matrix(T0 value, T... values)
+                : matrix(literal_values{ { static_cast<scalar_type>(value), static_cast<scalar_type>(values)... } }, detail::make_index_sequence<M>(), detail::make_index_sequence<N>())
+            {}
+
             template <class T0, class... T,
                 class = typename std::enable_if< 
+                    !is_literal_construction<T0, T...>::value &&
                     !(N*M <= detail::get_total_size<T0, T...>::value - detail::get_total_size<typename detail::last<T0, T...>::type >::value) &&
                     (N*M <= detail::get_total_size<T0, T...>::value),
                     void>::type 
@@ -255,6 +274,17 @@ namespace swizzle
 
         private:
 
+            template <size_t... Columns, size_t... Rows>
+            CXXSWIZZLE_CONSTEXPR matrix(const literal_values& s, detail::index_sequence<Columns...>, detail::index_sequence<Rows...> rows)
+                : m_data{ { make_column<Columns>(s, rows)... } }
+            {}
+
+            template <size_t Column, size_t... Rows>
+            static CXXSWIZZLE_CONSTEXPR column_type make_column(const literal_values& s, detail::index_sequence<Rows...>)
+            {
+                return column_type(s.values[Column * N + Rows]...);
+            }
+
             template <size_t offset, class T0, class... Tail>
             void construct(T0&& t0, Tail&&... tail)
             {
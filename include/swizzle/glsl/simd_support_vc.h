@@ -7,6 +7,8 @@
 #include <type_traits>
 #include <swizzle/detail/primitive_wrapper.h>
 #include <swizzle/glsl/vector_helper.h>
+#include <swizzle/glsl/uniform.h>
+#include <swizzle/glsl/soa_array.h>
 
 
 namespace swizzle
@@ -49,6 +51,32 @@ namespace swizzle
             typedef detail::vector_base< Size, proxy_generator, data_type > base_type;
         };
 
+        //! soa_array batches of a whole Vc vector; stores of partial batches are masked.
+        template <typename BoolType, typename AssignPolicy>
+        struct soa_batch_traits< vc_float<BoolType, AssignPolicy> >
+        {
+            typedef ::Vc::float_v::EntryType entry_type;
+            static const size_t size = ::Vc::float_v::Size;
+            static const size_t alignment = ::Vc::VectorAlignment;
+
+            static vc_float<BoolType, AssignPolicy> load(const entry_type* data)
+            {
+                return ::Vc::float_v(data, ::Vc::Aligned);
+            }
+
+            static void store(const vc_float<BoolType, AssignPolicy>& value, entry_type* data, size_t count)
+            {
+                auto raw = static_cast<::Vc::float_v>(value);
+                if (count == size)
+                {
+                    raw.store(data, ::Vc::Aligned);
+                }
+                else
+                {
+                    raw.store(data, ::Vc::float_v(::Vc::uint_v::IndexesFromZero()) < ::Vc::float_v(static_cast<entry_type>(count)), ::Vc::Aligned);
+                }
+            }
+        };
     }
 
     namespace detail
@@ -59,6 +87,13 @@ namespace swizzle
         {
             typedef ::swizzle::glsl::vector<::swizzle::glsl::vc_float<BoolType, AssignPolicy>, 1> type;
         };
+
+        //! Uniforms are plain floats; all the lanes would be the same anyway.
+        template <typename BoolType, typename AssignPolicy>
+        struct get_uniform_type_impl< ::swizzle::glsl::vc_float<BoolType, AssignPolicy> >
+        {
+            typedef ::Vc::float_v::EntryType type;
+        };
     }
 }
 
@@ -96,5 +131,11 @@ namespace Vc
         {
             return x - floor(x);
         }
+
+        template <typename T>
+        inline Vector<T> mod(const Vector<T>& x, const Vector<T>& y)
+        {
+            return x - y * floor(x / y);
+        }
     }
 }
\ No newline at end of file
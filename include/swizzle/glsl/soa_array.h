@@ -0,0 +1,237 @@
+// CxxSwizzle
+// Copyright (c) 2013-2015, Piotr Gwiazdowski <gwiazdorrr+github at gmail.com>
+#pragma once
+
+#include <cstring>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace swizzle
+{
+    namespace glsl
+    {
+        template < class ScalarType, size_t Size >
+        class vector;
+
+        //! How a batch type is loaded from and stored to component planes of a soa_array. This one is
+        //! for plain scalars, a batch of one; backends with multiple lanes specialise it (see simd_support_vc.h).
+        template <class BatchType>
+        struct soa_batch_traits
+        {
+            //! What the planes store.
+            typedef BatchType entry_type;
+            //! Number of lanes.
+            static const size_t size = 1;
+            //! Alignment loads and stores need.
+            static const size_t alignment = std::alignment_of<BatchType>::value;
+
+            //! Loads a batch from an aligned address.
+            static BatchType load(const entry_type* data)
+            {
+                return *data;
+            }
+
+            //! Stores first count (at least 1) lanes of the batch at an aligned address.
+            static void store(const BatchType& value, entry_type* data, size_t)
+            {
+                *data = value;
+            }
+        };
+
+        template <class VectorType>
+        class soa_array;
+
+        //! An array of vectors stored as structure of arrays: each component has a plane of its own, so
+        //! that batches of consecutive vectors (e.g. vector<vc_float, Size>) are loaded and stored with
+        //! plain vector loads and stores, rather than gathers and scatters. Planes are aligned and padded
+        //! to a multiple of alignment, so loads of the last, partial batch are safe (padding is zero);
+        //! stores of it are masked.
+        template <class ScalarType, size_t Size>
+        class soa_array< vector<ScalarType, Size> >
+        {
+            static_assert(std::is_trivially_copyable<ScalarType>::value, "Planes are copied with memcpy");
+
+        public:
+            typedef vector<ScalarType, Size> vector_type;
+            typedef ScalarType scalar_type;
+
+            //! Alignment of planes; enough for any Vc implementation and a cache line.
+            static const size_t alignment = 64;
+
+            soa_array()
+                : m_data(nullptr)
+                , m_size(0)
+                , m_stride(0)
+            {}
+
+            explicit soa_array(size_t size)
+                : soa_array()
+            {
+                resize(size);
+            }
+
+            soa_array(const soa_array& other)
+                : soa_array()
+            {
+                *this = other;
+            }
+
+            soa_array(soa_array&& other)
+                : soa_array()
+            {
+                swap(other);
+            }
+
+            soa_array& operator=(const soa_array& other)
+            {
+                if (this != &other)
+                {
+                    allocate(other.m_size);
+                    if (m_size)
+                    {
+                        std::memcpy(m_data, other.m_data, plane_bytes() * Size);
+                    }
+                }
+                return *this;
+            }
+
+            soa_array& operator=(soa_array&& other)
+            {
+                swap(other);
+                return *this;
+            }
+
+            void swap(soa_array& other)
+            {
+                std::swap(m_storage, other.m_storage);
+                std::swap(m_data, other.m_data);
+                std::swap(m_size, other.m_size);
+                std::swap(m_stride, other.m_stride);
+            }
+
+            size_t size() const
+            {
+                return m_size;
+            }
+
+            //! Keeps the first min(size, size()) vectors; new ones are zero.
+            void resize(size_t size)
+            {
+                soa_array old;
+                swap(old);
+                allocate(size);
+                size_t count = size < old.m_size ? size : old.m_size;
+                for (size_t i = 0; i < Size && count; ++i)
+                {
+                    std::memcpy(plane(i), old.plane(i), count * sizeof(scalar_type));
+                }
+            }
+
+            //! Values of a component of all the vectors.
+            scalar_type* plane(size_t component)
+            {
+                return m_data + component * m_stride;
+            }
+
+            const scalar_type* plane(size_t component) const
+            {
+                return m_data + component * m_stride;
+            }
+
+            vector_type get(size_t index) const
+            {
+                vector_type result;
+                for (size_t i = 0; i < Size; ++i)
+                {
+                    result[i] = plane(i)[index];
+                }
+                return result;
+            }
+
+            void set(size_t index, const vector_type& value)
+            {
+                for (size_t i = 0; i < Size; ++i)
+                {
+                    plane(i)[index] = value[i];
+                }
+            }
+
+            //! Number of lanes of the batch type, i.e. the step of batch indices.
+            template <class BatchType>
+            static size_t batch_size()
+            {
+                return soa_batch_traits<BatchType>::size;
+            }
+
+            //! Loads vectors [index; index + batch_size) as a batch; index needs to be a multiple of the
+            //! batch size. Lanes past the end are zero.
+            template <class BatchType>
+            vector<BatchType, Size> load(size_t index) const
+            {
+                typedef soa_batch_traits<BatchType> traits;
+                static_assert(std::is_same<typename traits::entry_type, scalar_type>::value, "Batch of a different scalar type");
+                static_assert(traits::alignment <= alignment, "Planes not aligned enough for the batch type");
+
+                vector<BatchType, Size> result;
+                for (size_t i = 0; i < Size; ++i)
+                {
+                    result[i] = traits::load(plane(i) + index);
+                }
+                return result;
+            }
+
+            //! Stores a batch as vectors [index; index + batch_size); index needs to be a multiple of the
+            //! batch size. Lanes past the end are not stored.
+            template <class BatchType>
+            void store(size_t index, const vector<BatchType, Size>& value)
+            {
+                typedef soa_batch_traits<BatchType> traits;
+                static_assert(std::is_same<typename traits::entry_type, scalar_type>::value, "Batch of a different scalar type");
+                static_assert(traits::alignment <= alignment, "Planes not aligned enough for the batch type");
+
+                size_t count = m_size - index < traits::size ? m_size - index : traits::size;
+                for (size_t i = 0; i < Size; ++i)
+                {
+                    traits::store(value[i], plane(i) + index, count);
+                }
+            }
+
+            //! Replaces every vector v with func(v), a batch at a time.
+            template <class BatchType, class Func>
+            void transform(Func func)
+            {
+                for (size_t i = 0; i < m_size; i += soa_batch_traits<BatchType>::size)
+                {
+                    store<BatchType>(i, func(load<BatchType>(i)));
+                }
+            }
+
+        private:
+            //! Makes room for size vectors, all zero.
+            void allocate(size_t size)
+            {
+                const size_t entriesPerAlignment = alignment / sizeof(scalar_type);
+                m_size = size;
+                m_stride = (size + entriesPerAlignment - 1) / entriesPerAlignment * entriesPerAlignment;
+                m_storage.reset(new char[plane_bytes() * Size + alignment]);
+
+                auto value = reinterpret_cast<uintptr_t>(m_storage.get());
+                m_data = reinterpret_cast<scalar_type*>((value + alignment - 1) & ~static_cast<uintptr_t>(alignment - 1));
+                std::memset(m_data, 0, plane_bytes() * Size);
+            }
+
+            size_t plane_bytes() const
+            {
+                return m_stride * sizeof(scalar_type);
+            }
+
+            std::unique_ptr<char[]> m_storage;
+            scalar_type* m_data;
+            size_t m_size;
+            //! Distance between planes, in entries.
+            size_t m_stride;
+        };
+    }
+}
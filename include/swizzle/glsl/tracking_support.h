@@ -0,0 +1,52 @@
+// CxxSwizzle
+// Copyright (c) 2013-2015, Piotr Gwiazdowski <gwiazdorrr+github at gmail.com>
+#pragma once
+
+#include <array>
+#include <swizzle/detail/primitive_wrapper.h>
+#include <swizzle/detail/tracking_scalar.h>
+#include <swizzle/glsl/vector_helper.h>
+
+
+namespace swizzle
+{
+    namespace glsl
+    {
+        //! A float that knows which inputs it has been computed from (see detail::tracking_scalar), so
+        //! that it can be told what a shader's output depends on.
+        typedef detail::primitive_wrapper < detail::tracking_scalar<float>, float, bool > tracking_float;
+
+
+        //! Specialise vector_helper so that it knows what to do.
+        template <size_t Size>
+        struct vector_helper<tracking_float, Size>
+        {
+            typedef std::array<tracking_float::internal_type, Size> data_type;
+
+            template <size_t... indices>
+            struct proxy_generator
+            {
+                typedef detail::indexed_proxy< vector<tracking_float, sizeof...(indices)>, data_type, indices...> type;
+            };
+
+            //! A factory of 1-component proxies.
+            template <size_t x>
+            struct proxy_generator<x>
+            {
+                typedef tracking_float type;
+            };
+
+            typedef detail::vector_base< Size, proxy_generator, data_type > base_type;
+        };
+    }
+
+    namespace detail
+    {
+        //! CxxSwizzle needs to know which vector to create if it needs to
+        template <>
+        struct get_vector_type_impl< ::swizzle::glsl::tracking_float >
+        {
+            typedef ::swizzle::glsl::vector<::swizzle::glsl::tracking_float, 1> type;
+        };
+    }
+}
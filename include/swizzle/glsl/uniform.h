@@ -0,0 +1,41 @@
+// CxxSwizzle
+// Copyright (c) 2013-2015, Piotr Gwiazdowski <gwiazdorrr+github at gmail.com>
+#pragma once
+
+#include <cstddef>
+
+namespace swizzle
+{
+    namespace glsl
+    {
+        template < class ScalarType, size_t Size >
+        class vector;
+    }
+
+    namespace detail
+    {
+        //! Type to specialise; defines what a value that is the same for all the pixels (an uniform)
+        //! is stored as if varyings are of type T. Unless the backend knows better, it's T itself.
+        template <class T>
+        struct get_uniform_type_impl
+        {
+            typedef T type;
+        };
+
+        //! Vectors of uniforms are vectors of uniform scalars.
+        template <class ScalarType, size_t Size>
+        struct get_uniform_type_impl< ::swizzle::glsl::vector<ScalarType, Size> >
+        {
+            typedef ::swizzle::glsl::vector<typename get_uniform_type_impl<ScalarType>::type, Size> type;
+        };
+    }
+
+    namespace glsl
+    {
+        //! Type of uniforms for varyings of type T. Backends processing several pixels at once (SIMD) keep
+        //! uniforms scalar, so that math on them is done once rather than for each lane; they broadcast
+        //! only when they meet a varying.
+        template <class T>
+        using uniform = typename detail::get_uniform_type_impl<T>::type;
+    }
+}
@@ -11,6 +11,7 @@
 #include <swizzle/detail/indexed_vector_iterator.h>
 #include <swizzle/detail/glsl/vector_functions_adapter.h>
 #include <swizzle/glsl/vector_helper.h>
+#include <swizzle/glsl/uniform.h>
 #include <swizzle/glsl/matrix.h>
 #include <swizzle/detail/static_functors.h>
 
@@ -33,7 +34,9 @@ namespace swizzle
                 typename std::conditional< 
                     Size == 1,
                     detail::nothing,
-                    detail::common_binary_operators<vector<ScalarType, Size>, ScalarType>
+                    detail::common_binary_operators<vector<ScalarType, Size>, ScalarType,
+                        typename detail::arg_type<vector<ScalarType, Size>, typename vector_helper<ScalarType, Size>::data_type>::type,
+                        typename detail::arg_type<ScalarType>::type>
                 >::type,
                 vector,
                 ScalarType,
@@ -64,12 +67,22 @@ namespace swizzle
             //! A helpful mnemonic
             typedef std::is_same<internal_scalar_type, scalar_type> are_scalar_types_same;
 
+            //! Storage of the components.
+            typedef typename vector_helper<ScalarType, Size>::data_type data_type;
+
+            //! Can the vector be constant-initialised from these? Only from Size arithmetic values and only
+            //! if it stores scalars as they are (SIMD types are not literal anyway).
+            template <class T0, class... T>
+            struct is_literal_construction : std::integral_constant<bool, Size != 1 && sizeof...(T) + 1 == Size && are_scalar_types_same::value &&
+                detail::all<std::is_arithmetic, typename detail::remove_reference_cv<T0>::type, typename detail::remove_reference_cv<T>::type...>::value>
+            {};
+
             //! Will be less pain when chaning to some magic mask type...
             typedef bool bool_type;
 
-            //! Well, passing by value is not supported for aligned types in VC++, so let's pass by reference ;(
-            typedef const scalar_type& scalar_arg_type;
-            typedef const vector_type& vector_arg_type;
+            //! Small vectors and scalars are passed by value, unless it's VC++ (see CXXSWIZZLE_PASS_BY_VALUE).
+            typedef typename detail::arg_type<scalar_type>::type scalar_arg_type;
+            typedef typename detail::arg_type<vector_type, data_type>::type vector_arg_type;
 
             //! Type static functions return; for single-component they decay to a scalar
             typedef typename std::conditional<Size==1, scalar_type, vector>::type decay_type;
@@ -79,27 +92,46 @@ namespace swizzle
         // CONSTRUCTION
         public:
             //! Default constructor.
-            inline vector()
-            {
-                m_data = {};
-            }
+            CXXSWIZZLE_CONSTEXPR vector()
+                : base_type(data_type())
+            {}
 
-            //! Copy constructor
-            inline vector(vector_arg_type o)
-            {
-                m_data = o.m_data;
-            }
+            //! Copy constructor; trivial if the data is, so that vectors can be passed in registers.
+            vector(const vector&) = default;
 
-            //! Implicit constructor from scalar-convertible only for one-component vector
-            vector(typename std::conditional<Size == 1, scalar_arg_type, detail::operation_not_available>::type s)
+            //! Implicit constructor from scalar-convertible only for one-component vector. A template,
+            //! so that explicit instantiations of bigger vectors (see instantiations.h) skip it.
+            template <size_t S = Size, class = typename std::enable_if<S == 1>::type>
+            vector(scalar_arg_type s)
             {
                 detail::static_foreach<detail::functor_assign>(*this, s);
             }
 
             //! For vectors bigger than 1 conversion from scalar should be explicit.
-            explicit vector( typename std::conditional<Size!=1, scalar_arg_type, detail::operation_not_available>::type s )
+            template <size_t S = Size, typename std::enable_if<S != 1, int>::type = 0>
+            CXXSWIZZLE_CONSTEXPR explicit vector(scalar_arg_type s)
+                : vector(s, detail::make_index_sequence<Size>(), are_scalar_types_same())
+            {}
+
+            //! Constructor from exactly Size arithmetic values; constexpr if the backend keeps scalars
+            //! as they are, so that constants end up constant-initialised.
+            template <class T0, class... T, class = typename std::enable_if<is_literal_construction<T0, T...>::value>::type>
+            CXXSWIZZLE_CONSTEXPR explicit vector(T0 value, T... values)
+                : base_type(data_type{ { static_cast<scalar_type>(value), static_cast<scalar_type>(values)... } })
+            {}
+
+            //! Implicit constructor from a vector of uniforms (or its proxy), if these are of a different type
+            //! (see glsl::uniform); the uniforms get broadcast. Not for one-component vectors: their uniform
+            //! type is a plain scalar and would make builtins called with literals ambiguous.
+            template <class T,
+                class = typename std::enable_if<
+                    (Size > 1) && !std::is_same<typename detail::get_uniform_type_impl<ScalarType>::type, ScalarType>::value &&
+                    std::is_same<typename detail::get_vector_type<T>::type, vector<typename detail::get_uniform_type_impl<ScalarType>::type, Size> >::value,
+                    void>::type
+                >
+            vector(T&& uniforms)
             {
-                detail::static_foreach<detail::functor_assign>(*this, s);
+                construct<0>(std::forward<T>(uniforms), detail::nothing{});
             }
 
             // Block of generic proxy-constructos calling construct member function. Compiler
@@ -107,7 +139,7 @@ namespace swizzle
             template <class T0, class... T,
                 class = typename std::enable_if< 
                     !(Size <= detail::get_total_size<T0, T...>::value - detail::get_total_size<typename detail::last<T0, T...>::type >::value) &&
-                        (Size <= detail::get_total_size<T0, T...>::value),
+                        (Size <= detail::get_total_size<T0, T...>::value) && !is_literal_construction<T0, T...>::value,
                     void>::type 
                 >
             explicit vector(T0&& t0, T&&... ts)
@@ -127,7 +159,7 @@ namespace swizzle
                 return at(i);
             }
 
-            const scalar_type& operator[](size_t i) const
+            CXXSWIZZLE_CONSTEXPR const scalar_type& operator[](size_t i) const
             {
                 return at(i);
             }
@@ -206,13 +238,26 @@ namespace swizzle
 
             // Conversion operator
 
-            //! Auto-decay to scalar type only if this is a 1-sized vector
-            inline  operator typename std::conditional<Size == 1, scalar_type, detail::operation_not_available>::type() const
+            //! Auto-decay to scalar type only if this is a 1-sized vector; bigger vectors "convert" to a type
+            //! nothing accepts, so that they can be explicitly instantiated (see instantiations.h).
+            inline operator typename std::conditional<Size == 1, scalar_type, detail::operation_not_available_tag>::type() const
             {
-                return at(0);
-            } 
+                return to_scalar(std::integral_constant<bool, Size == 1>());
+            }
 
         // AUXILIARY
+        private:
+
+            scalar_type to_scalar(std::true_type) const
+            {
+                return at(0);
+            }
+
+            detail::operation_not_available_tag to_scalar(std::false_type) const
+            {
+                return detail::operation_not_available_tag();
+            }
+
         public:
 
             //! These are chosen when internal_scalar_type and outside visible scalar type are same.
@@ -220,7 +265,7 @@ namespace swizzle
             {
                 return m_data[i];
             }
-            const internal_scalar_type& at(size_t i, std::true_type) const
+            CXXSWIZZLE_CONSTEXPR const internal_scalar_type& at(size_t i, std::true_type) const
             {
                 return m_data[i];
             }
@@ -242,7 +287,7 @@ namespace swizzle
             {
                 return at(i, are_scalar_types_same());
             }
-            const scalar_type& at(size_t i) const
+            CXXSWIZZLE_CONSTEXPR const scalar_type& at(size_t i) const
             {
                 return at(i, are_scalar_types_same());
             }
@@ -255,6 +300,18 @@ namespace swizzle
             
         private:
 
+            //! Broadcasting constructors; constexpr one is used if the vector stores scalars as they are.
+            template <size_t... Indices>
+            CXXSWIZZLE_CONSTEXPR vector(scalar_arg_type s, detail::index_sequence<Indices...>, std::true_type)
+                : base_type(data_type{ { (static_cast<void>(Indices), s)... } })
+            {}
+
+            template <size_t... Indices>
+            vector(scalar_arg_type s, detail::index_sequence<Indices...>, std::false_type)
+            {
+                detail::static_foreach<detail::functor_assign>(*this, s);
+            }
+
             template <size_t offset, class T0, class... Tail>
             void construct(T0&& t0, Tail&&... tail)
             {
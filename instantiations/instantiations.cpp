@@ -0,0 +1,25 @@
+// CxxSwizzle
+// Copyright (c) 2013-2015, Piotr Gwiazdowski <gwiazdorrr+github at gmail.com>
+//
+// Compiles the common vector and matrix types once, for translation units that declare them extern
+// (see swizzle/glsl/instantiations.h). Needs to be built with the same backend configuration and
+// configuration macros (CXXSWIZZLE_CONFIG_DEFINITIONS in CMake); the latter are checked at link time.
+
+#if defined(USE_SIMD)
+#include "use_simd.h"
+#else
+#include "use_scalar.h"
+#endif
+
+#include <swizzle/glsl/instantiations.h>
+
+void swizzle::detail::CXXSWIZZLE_CONFIGURATION_CHECK()
+{}
+
+CXXSWIZZLE_INSTANTIATE(, float)
+CXXSWIZZLE_INSTANTIATE(, double)
+CXXSWIZZLE_INSTANTIATE(, int)
+
+#if defined(USE_SIMD)
+CXXSWIZZLE_INSTANTIATE(, ::swizzle::glsl::vc_float<>)
+#endif
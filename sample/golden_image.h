@@ -0,0 +1,136 @@
+// CxxSwizzle
+// Copyright (c) 2013-2015, Piotr Gwiazdowski <gwiazdorrr+github at gmail.com>
+#pragma once
+
+// Golden image support: a rendered frame is either saved as a reference (binary PPM) or compared
+// against one, so that changes to the backend's math can be judged by how much the output drifts.
+
+#include <cstdint>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+#include <string>
+#include <fstream>
+#include <algorithm>
+#include <limits>
+
+//! 8-bit RGB image, rows top to bottom.
+struct RgbImage
+{
+    int w;
+    int h;
+    std::vector<uint8_t> pixels;
+
+    RgbImage()
+        : w(0)
+        , h(0)
+    {}
+
+    RgbImage(int w, int h)
+        : w(w)
+        , h(h)
+        , pixels(static_cast<size_t>(w) * h * 3)
+    {}
+
+    uint8_t* row(int y)
+    {
+        return pixels.data() + static_cast<size_t>(y) * w * 3;
+    }
+};
+
+inline bool savePPM(const RgbImage& image, const std::string& path)
+{
+    std::ofstream file(path, std::ios::binary);
+    file << "P6\n" << image.w << " " << image.h << "\n255\n";
+    file.write(reinterpret_cast<const char*>(image.pixels.data()), image.pixels.size());
+    return static_cast<bool>(file);
+}
+
+//! Reads binary, 8-bit PPMs (what savePPM writes) and PGMs, greys being expanded to RGB.
+inline bool loadPPM(RgbImage& image, const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    std::string magic;
+    int w = 0, h = 0, maxValue = 0;
+    if (!(file >> magic) || (magic != "P6" && magic != "P5"))
+    {
+        return false;
+    }
+    // skip comments
+    while (file >> std::ws && file.peek() == '#')
+    {
+        file.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+    }
+    if (!(file >> w >> h >> maxValue) || w <= 0 || h <= 0 || maxValue != 255)
+    {
+        return false;
+    }
+    file.get();
+
+    RgbImage result(w, h);
+    if (magic == "P5")
+    {
+        std::vector<uint8_t> greys(static_cast<size_t>(w) * h);
+        if (!file.read(reinterpret_cast<char*>(greys.data()), greys.size()))
+        {
+            return false;
+        }
+        for (size_t i = 0; i < greys.size(); ++i)
+        {
+            std::fill_n(result.pixels.begin() + i * 3, 3, greys[i]);
+        }
+    }
+    else if (!file.read(reinterpret_cast<char*>(result.pixels.data()), result.pixels.size()))
+    {
+        return false;
+    }
+    image = std::move(result);
+    return true;
+}
+
+//! Per channel differences between two images.
+struct ImageDiff
+{
+    int maxDiff;
+    double meanDiff;
+    //! Infinite if images are identical.
+    double psnr;
+    //! Number of pixels with any channel differing.
+    uint64_t differentPixels;
+};
+
+//! Compares images of the same size; the diff image (optional) gets absolute differences, amplified to be visible.
+inline ImageDiff compareImages(const RgbImage& a, const RgbImage& b, RgbImage* diffImage = nullptr)
+{
+    ImageDiff result = { 0, 0.0, 0.0, 0 };
+    if (diffImage)
+    {
+        *diffImage = RgbImage(a.w, a.h);
+    }
+
+    uint64_t sum = 0;
+    uint64_t sumSquares = 0;
+    for (size_t i = 0; i < a.pixels.size(); i += 3)
+    {
+        bool different = false;
+        for (size_t c = 0; c < 3; ++c)
+        {
+            int d = std::abs(int(a.pixels[i + c]) - int(b.pixels[i + c]));
+            result.maxDiff = std::max(result.maxDiff, d);
+            sum += d;
+            sumSquares += d * d;
+            different |= d != 0;
+            if (diffImage)
+            {
+                diffImage->pixels[i + c] = static_cast<uint8_t>(std::min(255, d * 16));
+            }
+        }
+        result.differentPixels += different;
+    }
+
+    double count = static_cast<double>(std::max<size_t>(1, a.pixels.size()));
+    result.meanDiff = sum / count;
+    double mse = sumSquares / count;
+    result.psnr = mse > 0 ? 10.0 * std::log10(255.0 * 255.0 / mse) : std::numeric_limits<double>::infinity();
+    return result;
+}
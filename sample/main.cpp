@@ -3,6 +3,10 @@
 
 #if defined(USE_SIMD)
 #include "use_simd.h"
+#elif defined(USE_COUNTING)
+#include "use_counting.h"
+#elif defined(USE_TRACKING)
+#include "use_tracking.h"
 #else
 #include "use_scalar.h"
 #endif
@@ -10,6 +14,8 @@
 #include <swizzle/glsl/vector.h>
 #include <swizzle/glsl/matrix.h>
 #include <swizzle/glsl/texture_functions.h>
+#include <swizzle/glsl/frame_constant.h>
+#include <swizzle/glsl/instantiations.h>
 
 typedef swizzle::glsl::vector< float_type, 2 > vec2;
 typedef swizzle::glsl::vector< float_type, 3 > vec3;
@@ -23,6 +29,11 @@ typedef swizzle::glsl::matrix< swizzle::glsl::vector, vec4::scalar_type, 2, 2> m
 typedef swizzle::glsl::matrix< swizzle::glsl::vector, vec4::scalar_type, 3, 3> mat3;
 typedef swizzle::glsl::matrix< swizzle::glsl::vector, vec4::scalar_type, 4, 4> mat4;
 
+#if defined(CXXSWIZZLE_EXTERN_TEMPLATES)
+// these come from the instantiations library
+CXXSWIZZLE_INSTANTIATE(extern, float_type)
+#endif
+
 
 //! A really, really simplistic sampler using SDLImage
 struct SDL_Surface;
@@ -69,25 +80,36 @@ namespace glsl_sandbox
         typedef ::float_type& float_type;
     }
 
+    // a nested namespace used when redefining 'in' keyword; cheap types are passed by value
     namespace in
     {
-        typedef const ::vec2& vec2;
-        typedef const ::vec3& vec3;
-        typedef const ::vec4& vec4;
-        typedef const ::float_type& float_type;
+        typedef ::vec2::vector_arg_type vec2;
+        typedef ::vec3::vector_arg_type vec3;
+        typedef ::vec4::vector_arg_type vec4;
+        typedef ::vec4::scalar_arg_type float_type;
+    }
+
+    // a nested namespace used when redefining 'uniform' keyword; uniforms are the same for all the
+    // pixels, so with SIMD they stay scalar until they meet a varying
+    namespace uniforms
+    {
+        typedef swizzle::glsl::uniform<::vec2> vec2;
+        typedef swizzle::glsl::uniform<::vec3> vec3;
+        typedef swizzle::glsl::uniform<::vec4> vec4;
+        typedef swizzle::glsl::uniform<::float_type> float_type;
     }
 
     #include <swizzle/glsl/vector_functions.h>
 
     // constants shaders are using
-    float_type time = 1;
-    vec2 mouse(0, 0);
-    vec2 resolution;
+    uniforms::float_type time = 1;
+    uniforms::vec2 mouse(0, 0);
+    uniforms::vec2 resolution;
 
     // constants some shaders from shader toy are using
-    vec2& iResolution = resolution;
-    float_type& iGlobalTime = time;
-    vec2& iMouse = mouse;
+    uniforms::vec2& iResolution = resolution;
+    uniforms::float_type& iGlobalTime = time;
+    uniforms::vec2& iMouse = mouse;
 
     sampler2D diffuse("diffuse.png", sampler2D::Repeat);
     sampler2D specular("specular.png", sampler2D::Repeat);
@@ -100,29 +122,39 @@ namespace glsl_sandbox
     };
 
     // change meaning of glsl keywords to match sandbox
-    #define uniform extern
+    #define uniform extern uniforms::
     #define in in::
     #define out ref::
     #define inout ref::
     #define main fragment_shader::operator()
     #define float float_type   
     #define bool bool_type
+    // values derived from uniforms only are computed once per frame; shaders define a GLSL fallback
+    // (a plain local) and parenthesise the value, as GLSL macros are not variadic
+    #define FRAME_CONSTANT(type, name, value) \
+        static swizzle::glsl::frame_constant<type> name##FrameConstant; \
+        const type& name = name##FrameConstant.get([&]() -> type { return value; })
     
     #pragma warning(push)
     #pragma warning(disable: 4244) // disable return implicit conversion warning
     #pragma warning(disable: 4305) // disable truncation warning
     
-    //#include "shaders/sampler.frag"
-    //#include "shaders/leadlight.frag"
-    //#include "shaders/terrain.frag"
-    //#include "shaders/complex.frag"
-    //#include "shaders/road.frag"
-    //#include "shaders/gears.frag"
-    //#include "shaders/water_turbulence.frag"
-    #include "shaders/sky.frag"
+    // the shader to run; can also be set from the command line, e.g. -DSHADER_FILE=\"shaders/gears.frag\"
+    #ifndef SHADER_FILE
+    //#define SHADER_FILE "shaders/sampler.frag"
+    //#define SHADER_FILE "shaders/leadlight.frag"
+    //#define SHADER_FILE "shaders/terrain.frag"
+    //#define SHADER_FILE "shaders/complex.frag"
+    //#define SHADER_FILE "shaders/road.frag"
+    //#define SHADER_FILE "shaders/gears.frag"
+    //#define SHADER_FILE "shaders/water_turbulence.frag"
+    #define SHADER_FILE "shaders/sky.frag"
+    #endif
+    #include SHADER_FILE
 
     // be a dear a clean up
     #pragma warning(pop)
+    #undef FRAME_CONSTANT
     #undef bool
     #undef float
     #undef main
@@ -147,9 +179,20 @@ namespace glsl_sandbox
 #include <time.h>
 #include <memory>
 #include <functional>
+#include <iomanip>
+#include <atomic>
+#include <chrono>
+#include <vector>
+#include <algorithm>
+#include <cstring>
+#include <cmath>
+#include <cassert>
 #if OMP_ENABLED
 #include <omp.h>
 #endif
+#include "perf_counters.h"
+#include "trace.h"
+#include "golden_image.h"
 
 //! A handy way of creating (and checking) unique_ptrs of SDL objects
 template <class T>
@@ -174,38 +217,215 @@ struct ScopedLock
 {
     SDL_mutex* mutex;
 
+    //! Does nothing if mutex is null.
     explicit ScopedLock( SDL_mutex* mutex ) : mutex(mutex)
     {
-        SDL_LockMutex(mutex);
+        if (mutex)
+        {
+            TRACE_SCOPE("lock");
+            SDL_LockMutex(mutex);
+        }
     }
 
     template <class T>
     explicit  ScopedLock( std::unique_ptr<SDL_mutex, T>& mutex ) : mutex(mutex.get())
     {
+        TRACE_SCOPE("lock");
         SDL_LockMutex(this->mutex);
     }
 
     ~ScopedLock()
     {
-        SDL_UnlockMutex(mutex);
+        if (mutex)
+        {
+            SDL_UnlockMutex(mutex);
+        }
+    }
+};
+
+
+#if defined(USE_COUNTING)
+//! Operations histogram of a frame (or a part of it).
+struct FrameOpStats
+{
+    swizzle::detail::op_counters counters;
+    uint64_t pixels;
+    uint64_t minPixelOps;
+    uint64_t maxPixelOps;
+
+    FrameOpStats() 
+        : pixels(0)
+        , minPixelOps(UINT64_MAX)
+        , maxPixelOps(0)
+    {}
+
+    void addPixel(const swizzle::detail::op_counters& pixelCounters)
+    {
+        auto total = pixelCounters.total();
+        minPixelOps = std::min(minPixelOps, total);
+        maxPixelOps = std::max(maxPixelOps, total);
+        counters += pixelCounters;
+        ++pixels;
+    }
+
+    void merge(const FrameOpStats& other)
+    {
+        minPixelOps = std::min(minPixelOps, other.minPixelOps);
+        maxPixelOps = std::max(maxPixelOps, other.maxPixelOps);
+        counters += other.counters;
+        pixels += other.pixels;
+    }
+};
+
+//! Prints the histogram; per pixel numbers are averages.
+void printOpStats(std::ostream& os, const FrameOpStats& stats)
+{
+    if (stats.pixels == 0)
+    {
+        return;
+    }
+
+    auto flags = os.flags();
+    auto precision = os.precision();
+
+    os << std::fixed << std::setprecision(2);
+    os << "\nops per pixel: " << stats.counters.total() / double(stats.pixels) << " (min: " << stats.minPixelOps << ", max: " << stats.maxPixelOps << ")"
+       << ", per frame: " << stats.counters.total() << "\n";
+
+    for (size_t i = 0; i < swizzle::detail::op_kind_count; ++i)
+    {
+        auto count = stats.counters.counts[i];
+        if (count)
+        {
+            os << std::setw(14) << swizzle::detail::get_op_name(static_cast<swizzle::detail::op_kind>(i)) 
+               << std::setw(12) << count / double(stats.pixels) 
+               << std::setw(16) << count << "\n";
+        }
     }
+
+    os.flags(flags);
+    os.precision(precision);
+}
+#endif
+
+//! Uniforms a part of a frame may depend on, as bits.
+const unsigned c_timeDependency = 1;
+const unsigned c_mouseDependency = 2;
+const unsigned c_resolutionDependency = 4;
+//! What anything whose dependencies are not tracked is assumed to depend on.
+const unsigned c_allDependencies = ~0u;
+
+//! Stats of a frame, or of a part of it.
+struct FrameStats
+{
+    //! Hardware counters, all threads combined.
+    PerfSample perf;
+    //! Number of pixels shaded.
+    uint64_t pixels;
+#if defined(USE_COUNTING)
+    FrameOpStats opStats;
+#endif
+#if defined(USE_TRACKING)
+    //! Uniforms each tile (see RateMap) depends on; empty if none got shaded.
+    std::vector<unsigned> tileDependencies;
+#endif
+
+    FrameStats()
+        : pixels(0)
+    {}
 };
 
+//! A frame, along with stats gathered when rendering it.
+struct FrameSlot
+{
+    std::unique_ptr< SDL_Surface, std::function<void (SDL_Surface*)> > surface;
+    //! Pixels of the surface; allocated here so that rows can be aligned.
+    std::vector<uint8_t> storage;
+    //! Index of the frame, as counted by the render thread.
+    int index;
+    //! An incomplete, progressively rendered frame; stats are not set for these.
+    bool preview;
+    //! Fraction of pixels shaded; less than 1 for previews only.
+    double coverage;
+    FrameStats stats;
+
+    FrameSlot()
+        : surface(makeUnique<SDL_Surface>(SDL_FreeSurface))
+        , index(0)
+        , preview(false)
+        , coverage(0)
+    {}
+};
 
-//! The surface to draw on.
-auto g_surface = makeUnique<SDL_Surface>( SDL_FreeSurface );
-//! Mutex used when exchaning frame between threads
-auto g_frameHandshakeMutex = makeUnique<SDL_mutex>( SDL_CreateMutex(), SDL_DestroyMutex );
-//! Signaled when a frame has been processed
-auto m_frameReceivedEvent = makeUnique<SDL_cond>( SDL_CreateCond(), SDL_DestroyCond );
-//! Signaled when a frame is ready to be processed
-auto m_frameReadyEvent = makeUnique<SDL_cond>( SDL_CreateCond(), SDL_DestroyCond );
-//! Additional flag set when a frame becomes ready, in case main thread is not waiting
-bool g_frameReady = false;
+//! Frames are triple buffered: the render thread draws to one slot, the main thread presents
+//! another one and the third one holds the latest complete frame. Only the index of the latter
+//! is shared and it is exchanged atomically, so neither thread ever waits for the other.
+FrameSlot g_frameSlots[3];
+//! Set in g_readySlot if the frame there hasn't been presented yet.
+const unsigned c_freshFrameBit = 4;
+//! Index of the latest complete frame's slot, possibly with c_freshFrameBit.
+std::atomic<unsigned> g_readySlot(1);
+//! Index of the slot being rendered; used only to show incomplete frames.
+std::atomic<unsigned> g_renderSlot(0);
+//! Posted each time a frame is completed.
+auto g_frameReadySemaphore = makeUnique<SDL_sem>( SDL_CreateSemaphore(0), SDL_DestroySemaphore );
+
+//! Values the main thread passes to the render thread; taken at the start of each frame.
+struct FrameParams
+{
+    float time;
+    glsl_sandbox::uniforms::vec2 mouse;
+    int width;
+    int height;
+    //! Format of frames, same as the screen's if possible, so that presenting is a plain copy.
+    uint32_t rmask, gmask, bmask;
+    //! The screen, if frames are to be rendered directly to it.
+    SDL_Surface* directSurface;
+    //! Change whenever the respective uniforms do.
+    unsigned timeVersion;
+    unsigned mouseVersion;
+    //! Area of the window (top-left origin) to be shaded at full rate when foveating; a point if empty.
+    SDL_Rect focus;
+};
+FrameParams g_frameParams;
+//! Guards g_frameParams and surface resizes.
+auto g_sharedStateMutex = makeUnique<SDL_mutex>( SDL_CreateMutex(), SDL_DestroyMutex );
+//! When rendering directly to the screen: held by the render thread while it draws and by
+//! the main thread while it presents or resizes the screen.
+auto g_screenMutex = makeUnique<SDL_mutex>( SDL_CreateMutex(), SDL_DestroyMutex );
+//! When rendering directly to the screen: posted once a frame has been presented (or dropped).
+auto g_framePresentedSemaphore = makeUnique<SDL_sem>( SDL_CreateSemaphore(0), SDL_DestroySemaphore );
+
+//! Render straight to the screen instead of slots; set once, before the render thread starts.
+bool g_renderDirect = false;
+//! If non-zero, frames started after a restart (the first one, after a resize or a mouse drag) are
+//! rendered coarse to fine and whatever is done gets shown this often; set once, before the render
+//! thread starts.
+std::chrono::milliseconds g_progressiveBudget(0);
+//! If non-zero, the render resolution gets scaled down so that frames take about this long and
+//! the main thread stretches them to the screen; set once, before the render thread starts.
+std::chrono::milliseconds g_targetFrameTime(0);
+//! Shade 1/g_interleave of pixels per frame (1, 2 or 4) and reconstruct the rest from the previous
+//! frame; set once, before the render thread starts.
+int g_interleave = 1;
+//! Variable rate shading, with rates from this image (if not empty) or from the contrast of the
+//! previous frame; set once, before the render thread starts.
+RgbImage g_rateImage;
+bool g_autoRates = false;
+//! With automatic rates, each this many frames are shaded in full, so that detail that appears
+//! between coarse samples gets noticed.
+const int c_autoRatesRefreshInterval = 16;
+//! Shade at full rate only around FrameParams::focus; set once, before the render thread starts.
+bool g_foveate = false;
 //! Stop drawing
-bool g_cancelDraw = false;
+std::atomic<bool> g_cancelDraw(false);
 //! Quit!
-bool g_quit = false;
+std::atomic<bool> g_quit(false);
+
+//! Hardware counters of all complete frames so far; written by the render thread only.
+PerfSample g_shaderPerf;
+uint64_t g_shaderPixels = 0;
+uint64_t g_shaderFrames = 0;
 
 const float_type c_one = 1.0f;
 const float_type c_zero = 0.0f;
@@ -218,8 +438,253 @@ T* alignPtr(T* ptr)
     return reinterpret_cast<T*>((value + Align) & (~(Align - 1)));
 }
 
-//! Thread used for rendering; it invokes the shader
-static int renderThread(void*)
+//! Copies the surface to a RGB image, whatever its format.
+RgbImage captureSurface(SDL_Surface* surface)
+{
+    RgbImage image(surface->w, surface->h);
+    auto& format = *surface->format;
+    for (int y = 0; y < surface->h; ++y)
+    {
+        auto src = static_cast<uint8_t*>(surface->pixels) + y * surface->pitch;
+        auto dst = image.row(y);
+        for (int x = 0; x < surface->w; ++x, src += format.BytesPerPixel)
+        {
+            uint32_t pixel = 0;
+            for (int i = 0; i < format.BytesPerPixel; ++i)
+            {
+                pixel |= (src[i] << (i * 8));
+            }
+            *dst++ = static_cast<uint8_t>((pixel & format.Rmask) >> format.Rshift);
+            *dst++ = static_cast<uint8_t>((pixel & format.Gmask) >> format.Gshift);
+            *dst++ = static_cast<uint8_t>((pixel & format.Bmask) >> format.Bshift);
+        }
+    }
+    return image;
+}
+
+//! Saves the frame as the golden image if there's none yet, compares against it otherwise.
+//! \return false on errors
+bool processGoldenImage(SDL_Surface* surface, const std::string& path)
+{
+    using namespace std;
+
+    auto frame = captureSurface(surface);
+    RgbImage golden;
+    if (!loadPPM(golden, path))
+    {
+        if (!savePPM(frame, path))
+        {
+            cerr << "\nERROR: unable to save golden image " << path << endl;
+            return false;
+        }
+        cout << "\ngolden image saved to " << path << endl;
+        return true;
+    }
+
+    if (golden.w != frame.w || golden.h != frame.h)
+    {
+        cerr << "\nERROR: golden image is " << golden.w << "," << golden.h << ", frame is " << frame.w << "," << frame.h << endl;
+        return false;
+    }
+
+    RgbImage diffImage;
+    auto diff = compareImages(golden, frame, &diffImage);
+    cout << "\ngolden image diff: max " << diff.maxDiff << ", mean " << diff.meanDiff << ", PSNR " << diff.psnr << " dB, "
+         << diff.differentPixels << " of " << static_cast<uint64_t>(frame.w) * frame.h << " pixels differ" << endl;
+    if (diff.differentPixels)
+    {
+        // amplified differences, to see where the drift is
+        savePPM(diffImage, path + ".diff.ppm");
+    }
+    return true;
+}
+
+//! Makes the slot's surface match the params; slots get resized lazily, when they are about to be drawn on.
+//! \return false if the surface couldn't be created
+static bool prepareSlot(FrameSlot& slot, const FrameParams& params)
+{
+    auto surface = slot.surface.get();
+    if ( surface && surface->w == params.width && surface->h == params.height && 
+         surface->format->Rmask == params.rmask && surface->format->Gmask == params.gmask && surface->format->Bmask == params.bmask )
+    {
+        return true;
+    }
+
+    // 32 bits per pixel, so that a batch of pixels can be written with a single store,
+    // and each row aligned, so that the store can be an aligned one
+    int pitch = static_cast<int>((params.width * 4 + uint_entries_align - 1) / uint_entries_align * uint_entries_align);
+    slot.surface.reset();
+    slot.storage.resize(pitch * params.height + uint_entries_align);
+    auto pixels = alignPtr<uint_entries_align>(slot.storage.data());
+    slot.surface.reset( SDL_CreateRGBSurfaceFrom(pixels, params.width, params.height, 32, pitch, params.rmask, params.gmask, params.bmask, 0 ) );
+    return slot.surface != nullptr;
+}
+
+typedef std::chrono::steady_clock RenderClock;
+
+//! Shading rate per tile: 1, 2 or 4, meaning a pixel per 1x1, 2x2 or 4x4 block, or 0 meaning
+//! the tile is kept as it was in the previous frame.
+struct RateMap
+{
+    //! A multiple of all rates, so that blocks never cross tiles.
+    static const int c_tileSize = 16;
+
+    int tilesX;
+    int tilesY;
+    std::vector<uint8_t> rates;
+
+    //! No tiles; used for "unknown".
+    RateMap()
+        : tilesX(0)
+        , tilesY(0)
+    {}
+
+    RateMap(int w, int h)
+        : tilesX((w + c_tileSize - 1) / c_tileSize)
+        , tilesY((h + c_tileSize - 1) / c_tileSize)
+        , rates(tilesX * tilesY, 1)
+    {}
+
+    int get(int tileX, int tileY) const
+    {
+        return rates[tileY * tilesX + tileX];
+    }
+
+    //! The image is stretched over the frame; the centre of each tile picks its rate: white (>= 170)
+    //! is full rate, grey (>= 85) 2x2 and black 4x4.
+    static RateMap fromImage(const RgbImage& image, int w, int h)
+    {
+        RateMap map(w, h);
+        for (int ty = 0; ty < map.tilesY; ++ty)
+        {
+            for (int tx = 0; tx < map.tilesX; ++tx)
+            {
+                int x = std::min(tx * c_tileSize + c_tileSize / 2, w - 1) * image.w / w;
+                int y = std::min(ty * c_tileSize + c_tileSize / 2, h - 1) * image.h / h;
+                int value = image.pixels[(static_cast<size_t>(y) * image.w + x) * 3];
+                map.rates[ty * map.tilesX + tx] = value >= 170 ? 1 : (value >= 85 ? 2 : 4);
+            }
+        }
+        return map;
+    }
+
+    //! Full rate within 1/8 of the frame's longer side from the focus rectangle (top-left origin),
+    //! 2x2 within 1/4 and 4x4 further away.
+    static RateMap fromFocus(int w, int h, const SDL_Rect& focus)
+    {
+        RateMap map(w, h);
+        double size = std::max(w, h);
+        for (int ty = 0; ty < map.tilesY; ++ty)
+        {
+            for (int tx = 0; tx < map.tilesX; ++tx)
+            {
+                int x = tx * c_tileSize + c_tileSize / 2;
+                int y = ty * c_tileSize + c_tileSize / 2;
+                int dx = std::max(0, std::max(focus.x - x, x - (focus.x + focus.w)));
+                int dy = std::max(0, std::max(focus.y - y, y - (focus.y + focus.h)));
+                double distance = std::sqrt(static_cast<double>(dx * dx + dy * dy)) / size;
+                map.rates[ty * map.tilesX + tx] = distance < 0.125 ? 1 : (distance < 0.25 ? 2 : 4);
+            }
+        }
+        return map;
+    }
+
+    //! Rates from the local contrast of a (32 bit) frame: tiles whose channels vary little get shaded
+    //! coarsely. Tiles that were coarse in that frame show only the variation between their samples.
+    static RateMap fromContrast(SDL_Surface* frame)
+    {
+        const int c_fullRateContrast = 24;
+        const int c_halfRateContrast = 8;
+
+        auto& format = *frame->format;
+        const int shifts[3] = { format.Rshift, format.Gshift, format.Bshift };
+        RateMap map(frame->w, frame->h);
+        for (int ty = 0; ty < map.tilesY; ++ty)
+        {
+            for (int tx = 0; tx < map.tilesX; ++tx)
+            {
+                int lo[3] = { 255, 255, 255 };
+                int hi[3] = { 0, 0, 0 };
+                for (int y = ty * c_tileSize; y < std::min((ty + 1) * c_tileSize, frame->h); ++y)
+                {
+                    auto row = reinterpret_cast<const uint32_t*>(static_cast<uint8_t*>(frame->pixels) + y * frame->pitch);
+                    for (int x = tx * c_tileSize; x < std::min((tx + 1) * c_tileSize, frame->w); ++x)
+                    {
+                        for (int c = 0; c < 3; ++c)
+                        {
+                            int value = (row[x] >> shifts[c]) & 0xff;
+                            lo[c] = std::min(lo[c], value);
+                            hi[c] = std::max(hi[c], value);
+                        }
+                    }
+                }
+                int contrast = std::max(hi[0] - lo[0], std::max(hi[1] - lo[1], hi[2] - lo[2]));
+                map.rates[ty * map.tilesX + tx] = contrast >= c_fullRateContrast ? 1 : (contrast >= c_halfRateContrast ? 2 : 4);
+            }
+        }
+        return map;
+    }
+};
+
+const int RateMap::c_tileSize;
+
+//! Which pixels a pass shades: every step-th one in both directions, starting at offsetX, offsetY.
+struct PassLayout
+{
+    int step;
+    int offsetX;
+    int offsetY;
+    //! Skip pixels the previous, twice as coarse pass has shaded.
+    bool skipCoarse;
+    //! Only for step 1: every other pixel, starting at offsetX in even rows and next to it in odd ones.
+    bool checkerboard;
+    //! Each pixel fills a step x step block, so that the frame is complete after the pass, if blocky.
+    bool fillBlocks;
+    //! Only for step 1: if set, tiles shade a pixel per rate x rate block and fill the block with it;
+    //! tiles with rate 0 are skipped.
+    const RateMap* rates;
+};
+
+//! All pixels in one go.
+const PassLayout c_fullFrame = { 1, 0, 0, false, false, false, nullptr };
+//! Coarse to fine: 1/16 of pixels, then up to 1/4, then the rest. Each pixel is shaded once.
+const PassLayout c_progressivePasses[] = { { 4, 0, 0, false, false, true, nullptr }, { 2, 0, 0, true, false, true, nullptr }, { 1, 0, 0, true, false, true, nullptr } };
+const int c_progressivePassCount = sizeof(c_progressivePasses) / sizeof(c_progressivePasses[0]);
+
+inline int getPassRowCount(const PassLayout& layout, int height)
+{
+    return std::max(0, (height - layout.offsetY + layout.step - 1) / layout.step);
+}
+
+//! Pixels shaded in a frame when interleaving: half of them, in a checkerboard, or one of each 2x2
+//! quad. The pattern shifts with each frame, so that all pixels get shaded every 2 or 4 frames.
+inline PassLayout getInterleavedLayout(int interleave, int frameIndex)
+{
+    if ( interleave == 2 )
+    {
+        PassLayout layout = { 1, frameIndex & 1, 0, false, true, false, nullptr };
+        return layout;
+    }
+    // diagonal neighbours first, so that consecutive frames are spread the most
+    static const int c_quadOrder[4][2] = { { 0, 0 }, { 1, 1 }, { 1, 0 }, { 0, 1 } };
+    auto& offset = c_quadOrder[frameIndex % 4];
+    PassLayout layout = { 2, offset[0], offset[1], false, false, false, nullptr };
+    return layout;
+}
+
+//! Only for layouts without skipCoarse and rates.
+inline bool isShaded(const PassLayout& layout, int x, int y)
+{
+    if ( (y - layout.offsetY) % layout.step != 0 )
+    {
+        return false;
+    }
+    return layout.checkerboard ? ((x + y + layout.offsetX) & 1) == 0 : (x - layout.offsetX) % layout.step == 0;
+}
+
+//! Shades rows of the pass that are not marked in rowsDone, until all are, the deadline passes
+//! (each thread shades at least a row, though) or drawing gets cancelled. Completed rows get marked.
+static void shadePass(SDL_Surface* bmp, const PassLayout& layout, int frameIndex, std::vector<uint8_t>& rowsDone, RenderClock::time_point deadline, FrameStats& stats)
 {
     using ::swizzle::detail::static_for;
 
@@ -237,97 +702,707 @@ static int renderThread(void*)
 
         load_aligned(offsets, aligned);
     }
-   
 
-    while (true)
-    {
-        auto bmp = g_surface.get();
+    const int rowCount = static_cast<int>(rowsDone.size());
 
 #if !defined(_DEBUG) && OMP_ENABLED
 #pragma omp parallel 
-        {
-            int thredsCount = omp_get_num_threads();
-            int threadNum = omp_get_thread_num();
+    {
+        int thredsCount = omp_get_num_threads();
+        int threadNum = omp_get_thread_num();
 
-            int heightStep = thredsCount;
-            int heightStart = threadNum;
-            int heightEnd = bmp->h;
-#else
+        int rowStep = thredsCount;
+        int rowStart = threadNum;
+        if (trace::isEnabled())
         {
-            int heightStep = 1;
-            int heightStart = 0;
-            int heightEnd = bmp->h;
+            // not building the name every frame unless tracing
+            trace::setThreadName("render " + std::to_string(threadNum));
+        }
+#else
+    {
+        int rowStep = 1;
+        int rowStart = 0;
+        trace::setThreadName("render");
+#endif
+        TRACE_SCOPE("shade", "frame", frameIndex);
+
+        // check the comment above for explanation
+        unsigned unalignedBlob[3 * (scalar_count + uint_entries_align / sizeof(unsigned))];
+        unsigned* pr = alignPtr<uint_entries_align>(unalignedBlob);
+        unsigned* pg = alignPtr<uint_entries_align>(pr + scalar_count);
+        unsigned* pb = alignPtr<uint_entries_align>(pg + scalar_count);
+        uint8_t unalignedXBlob[scalar_count * sizeof(float) + float_entries_align];
+        float* px = alignPtr<float_entries_align>(reinterpret_cast<float*>(unalignedXBlob));
+
+        // with variable rate, columns of a row to shade and sizes of their blocks
+        std::vector<int> columnX;
+        std::vector<int> columnRate;
+
+        glsl_sandbox::fragment_shader shader;
+
+        // frame slots are always 32 bit and direct rendering is only enabled for 32 bit screens
+        auto& format = *bmp->format;
+        assert(format.BytesPerPixel == 4);
+        const bool alignedRows = reinterpret_cast<uintptr_t>(bmp->pixels) % uint_entries_align == 0 && bmp->pitch % uint_entries_align == 0;
+        const uint_type alpha = format.Amask;
+        // inactive lanes of the last batch in a row shade the last pixel
+        const float_type lastX = static_cast<float>(bmp->w - 1);
+
+#if defined(USE_COUNTING)
+        FrameOpStats threadOpStats;
+        auto& pixelCounters = swizzle::detail::op_counters::current();
 #endif
-            // check the comment above for explanation
-            unsigned unalignedBlob[3 * (scalar_count + uint_entries_align / sizeof(unsigned))];
-            unsigned* pr = alignPtr<uint_entries_align>(unalignedBlob);
-            unsigned* pg = alignPtr<uint_entries_align>(pr + scalar_count);
-            unsigned* pb = alignPtr<uint_entries_align>(pg + scalar_count);
+#if defined(USE_TRACKING)
+        static_assert(scalar_count == 1, "Dependencies are tracked per pixel");
+        const int tilesX = (bmp->w + RateMap::c_tileSize - 1) / RateMap::c_tileSize;
+        const int tilesY = (bmp->h + RateMap::c_tileSize - 1) / RateMap::c_tileSize;
+        std::vector<unsigned> threadDependencies(tilesX * tilesY, 0);
+        auto& controlDependencies = swizzle::detail::dependency_tracker::current();
+#endif
+
+        // counters are per thread, so are opened once per (OpenMP) thread
+        static thread_local PerfCounters s_perfCounters;
+        PerfSample threadPerf;
+        uint64_t threadPixels = 0;
+        s_perfCounters.begin();
 
-            glsl_sandbox::fragment_shader shader;
-  
-            for (int y = heightStart; !g_cancelDraw && y < heightEnd; y += heightStep)
+        bool shadedAnyRow = false;
+        for (int row = rowStart; !g_cancelDraw && row < rowCount; row += rowStep)
+        {
+            if (rowsDone[row])
+            {
+                continue;
+            }
+            if (shadedAnyRow && RenderClock::now() >= deadline)
             {
-                shader.gl_FragCoord.y = static_cast<float>(bmp->h - 1 - y);
+                break;
+            }
 
-                uint8_t * ptr = reinterpret_cast<uint8_t*>(bmp->pixels) + y * bmp->pitch;
+            const int y = layout.offsetY + row * layout.step;
+            TRACE_SCOPE("row", "y", y);
+            shader.gl_FragCoord.y = static_cast<float>(bmp->h - 1 - y);
+
+            int xStart = layout.offsetX;
+            int xStride = layout.step;
+            if (layout.skipCoarse && y % (2 * layout.step) == 0)
+            {
+                // rows shared with the coarser pass have every other pixel shaded already
+                xStart = layout.step;
+                xStride = 2 * layout.step;
+            }
+            else if (layout.checkerboard)
+            {
+                xStart = (layout.offsetX + y) & 1;
+                xStride = 2;
+            }
+            int columns = xStart < bmp->w ? (bmp->w - xStart + xStride - 1) / xStride : 0;
+            const int blockSize = layout.fillBlocks ? layout.step : 1;
 
-                int limitX = bmp->w - scalar_count;
-                for (int x = 0; x < bmp->w; x += scalar_count)
+            if (layout.rates)
+            {
+                // tiles shade every rate-th row; tiles start at multiples of all rates
+                auto& rates = *layout.rates;
+                columnX.clear();
+                columnRate.clear();
+                for (int tileX = 0; tileX < rates.tilesX; ++tileX)
                 {
-                    // since we are likely moving by more than one pixel,
-                    // this will shift x and ptr left in case of width and scalar_count
-                    // not being aligned; will redraw up to (scalar_count-1) pixels,
-                    // but well, what you gonna do.
-                    if (x > limitX)
+                    int rate = rates.get(tileX, y / RateMap::c_tileSize);
+                    if (rate && y % rate == 0)
                     {
-                        ptr -= 3 * (x - limitX);
-                        x = limitX;
+                        for (int x = tileX * RateMap::c_tileSize; x < std::min((tileX + 1) * RateMap::c_tileSize, bmp->w); x += rate)
+                        {
+                            columnX.push_back(x);
+                            columnRate.push_back(rate);
+                        }
                     }
+                }
+                columns = static_cast<int>(columnX.size());
+            }
+            const raw_float_type laneOffsets = offsets * static_cast<float>(xStride);
+
+            uint8_t* rowPtr = reinterpret_cast<uint8_t*>(bmp->pixels) + y * bmp->pitch;
 
-                    shader.gl_FragCoord.x = static_cast<float>(x) + offsets;
+            for (int column = 0; column < columns; column += scalar_count)
+            {
+                // the last batch in a row may be partial, in which case only the active lanes get stored
+                const size_t count = std::min<size_t>(scalar_count, columns - column);
+                const int x = xStart + column * xStride;
+
+                if (layout.rates)
+                {
+                    // inactive lanes repeat the last column
+                    static_for<0, scalar_count>([&](size_t i) { px[i] = static_cast<float>(columnX[column + std::min(i, count - 1)]); });
+                    raw_float_type fragX;
+                    load_aligned(fragX, px);
+                    shader.gl_FragCoord.x = fragX;
+                }
+                else
+                {
+                    shader.gl_FragCoord.x = static_cast<float>(x) + laneOffsets;
+                    if (count < scalar_count)
+                    {
+                        shader.gl_FragCoord.x = glsl_sandbox::min(shader.gl_FragCoord.x, lastX);
+                    }
+                }
                     
-                    // vvvvvvvvvvvvvvvvvvvvvvvvvv
-                    // THE SHADER IS INVOKED HERE
-                    // ^^^^^^^^^^^^^^^^^^^^^^^^^^
-                    shader();
+#if defined(USE_COUNTING)
+                pixelCounters.reset();
+#endif
+#if defined(USE_TRACKING)
+                controlDependencies.reset();
+#endif
+
+                // vvvvvvvvvvvvvvvvvvvvvvvvvv
+                // THE SHADER IS INVOKED HERE
+                // ^^^^^^^^^^^^^^^^^^^^^^^^^^
+                shader();
 
-                    // convert to [0;255]
-                    auto color = glsl_sandbox::clamp(shader.gl_FragColor, c_zero, c_one);
-                    color *= 255 + 0.5f;
+#if defined(USE_COUNTING)
+                threadOpStats.addPixel(pixelCounters);
+#endif
+#if defined(USE_TRACKING)
+                {
+                    // the colour depends on what its channels were computed from and on any decisions made on the way
+                    auto getDependencies = [](const float_type& value) { return static_cast<raw_float_type>(value).dependencies; };
+                    const int pixelX = layout.rates ? columnX[column] : x;
+                    threadDependencies[(y / RateMap::c_tileSize) * tilesX + pixelX / RateMap::c_tileSize] |= controlDependencies.mask |
+                        getDependencies(shader.gl_FragColor.r) | getDependencies(shader.gl_FragColor.g) | getDependencies(shader.gl_FragColor.b);
+                }
+#endif
 
-                    // save in the bitmap
-                    store_aligned(static_cast<uint_type>(static_cast<raw_float_type>(color.r)), pr);
-                    store_aligned(static_cast<uint_type>(static_cast<raw_float_type>(color.g)), pg);
-                    store_aligned(static_cast<uint_type>(static_cast<raw_float_type>(color.b)), pb);
+                // convert to [0;255]; clamping here is what saturates channels
+                auto color = glsl_sandbox::clamp(shader.gl_FragColor, c_zero, c_one);
+                color *= 255 + 0.5f;
 
-                    static_for<0, scalar_count>([&](size_t i)
+                uint_type r = static_cast<uint_type>(static_cast<raw_float_type>(color.r));
+                uint_type g = static_cast<uint_type>(static_cast<raw_float_type>(color.g));
+                uint_type b = static_cast<uint_type>(static_cast<raw_float_type>(color.b));
+
+                // save in the bitmap
+                if (xStride == 1 && !layout.rates)
+                {
+                    // shifts take care of any channel order (RGBA, BGRA...)
+                    uint_type pixels = (r << format.Rshift) | (g << format.Gshift) | (b << format.Bshift) | alpha;
+                    auto ptr = reinterpret_cast<unsigned*>(rowPtr) + x;
+                    if (count == scalar_count)
+                    {
+                        store_pixels(pixels, ptr, alignedRows);
+                    }
+                    else
                     {
-                        *ptr++ = static_cast<uint8_t>(pr[i]);
-                        *ptr++ = static_cast<uint8_t>(pg[i]);
-                        *ptr++ = static_cast<uint8_t>(pb[i]);
-                    });
+                        store_masked(pixels, ptr, count);
+                    }
                 }
+                else
+                {
+                    store_aligned(r, pr);
+                    store_aligned(g, pg);
+                    store_aligned(b, pb);
+
+                    // pixels are not adjacent; each fills its block, up to the frame's edges
+                    for (size_t i = 0; i < count; ++i)
+                    {
+                        const int laneX = layout.rates ? columnX[column + i] : x + static_cast<int>(i) * xStride;
+                        const int laneBlockSize = layout.rates ? columnRate[column + i] : blockSize;
+                        const int blockWidth = std::min(laneBlockSize, bmp->w - laneX);
+                        const int blockHeight = std::min(laneBlockSize, bmp->h - y);
+                        const uint32_t pixel = (pr[i] << format.Rshift) | (pg[i] << format.Gshift) | (pb[i] << format.Bshift) | format.Amask;
+                        for (int by = 0; by < blockHeight; ++by)
+                        {
+                            uint32_t* ptr = reinterpret_cast<uint32_t*>(rowPtr + by * bmp->pitch) + laneX;
+                            for (int bx = 0; bx < blockWidth; ++bx)
+                            {
+                                ptr[bx] = pixel;
+                            }
+                        }
+                    }
+                }
+
+                threadPixels += count;
             }
+
+            rowsDone[row] = 1;
+            shadedAnyRow = true;
         }
 
-        ScopedLock lock(g_frameHandshakeMutex);
-        if ( g_quit )
+        s_perfCounters.end(threadPerf);
+
+        ScopedLock lock(g_sharedStateMutex);
+        stats.perf += threadPerf;
+        stats.pixels += threadPixels;
+#if defined(USE_COUNTING)
+        stats.opStats.merge(threadOpStats);
+#endif
+#if defined(USE_TRACKING)
+        stats.tileDependencies.resize(threadDependencies.size(), 0);
+        for (size_t i = 0; i < threadDependencies.size(); ++i)
         {
-            return 0;
+            stats.tileDependencies[i] |= threadDependencies[i];
         }
-        else
+#endif
+    }
+}
+
+//! Fills pixels the interleaved pass hasn't shaded with those of the previous frame, clamped to
+//! the range of shaded neighbours (per channel), so that stale colours don't linger. There's no
+//! reprojection, shaders don't expose their cameras. Both surfaces need to be 32 bit, of the same format.
+static void reconstruct(SDL_Surface* bmp, const PassLayout& layout, SDL_Surface* history)
+{
+    TRACE_SCOPE("reconstruct");
+    auto& format = *bmp->format;
+    const int shifts[3] = { format.Rshift, format.Gshift, format.Bshift };
+    const int w = bmp->w;
+    const int h = bmp->h;
+
+#if !defined(_DEBUG) && OMP_ENABLED
+#pragma omp parallel for schedule(static)
+#endif
+    for (int y = 0; y < h; ++y)
+    {
+        auto getRow = [&](SDL_Surface* surface, int rowY) -> uint32_t*
         {
-            // frame is ready, change bool and raise signal (in case main thread is waiting)
-            g_frameReady = true;
-            SDL_CondSignal(m_frameReadyEvent.get());
+            return reinterpret_cast<uint32_t*>(static_cast<uint8_t*>(surface->pixels) + rowY * surface->pitch);
+        };
+        uint32_t* row = getRow(bmp, y);
+        const uint32_t* historyRow = getRow(history, y);
 
-            // wait for the main thread to process the frame
-            SDL_CondWait(m_frameReceivedEvent.get(), g_frameHandshakeMutex.get());
+        for (int x = 0; x < w; ++x)
+        {
+            if ( isShaded(layout, x, y) )
+            {
+                continue;
+            }
+
+            int lo[3] = { 255, 255, 255 };
+            int hi[3] = { 0, 0, 0 };
+            for (int ny = std::max(0, y - 1); ny <= std::min(h - 1, y + 1); ++ny)
+            {
+                const uint32_t* neighbourRow = getRow(bmp, ny);
+                for (int nx = std::max(0, x - 1); nx <= std::min(w - 1, x + 1); ++nx)
+                {
+                    if ( isShaded(layout, nx, ny) )
+                    {
+                        for (int c = 0; c < 3; ++c)
+                        {
+                            int value = (neighbourRow[nx] >> shifts[c]) & 0xff;
+                            lo[c] = std::min(lo[c], value);
+                            hi[c] = std::max(hi[c], value);
+                        }
+                    }
+                }
+            }
+
+            uint32_t pixel = format.Amask;
+            for (int c = 0; c < 3; ++c)
+            {
+                int value = (historyRow[x] >> shifts[c]) & 0xff;
+                // no shaded neighbours (1 pixel tall frames) means the history is taken as is
+                if ( lo[c] <= hi[c] )
+                {
+                    value = std::min(std::max(value, lo[c]), hi[c]);
+                }
+                pixel |= static_cast<uint32_t>(value) << shifts[c];
+            }
+            row[x] = pixel;
+        }
+    }
+}
+
+//! Copies tiles with rate 0 from the previous frame; both need to be of the same size and format.
+static void copyKeptTiles(SDL_Surface* bmp, SDL_Surface* history, const RateMap& rates)
+{
+    TRACE_SCOPE("copy kept tiles");
+    const int bytesPerPixel = bmp->format->BytesPerPixel;
+    for (int y = 0; y < bmp->h; ++y)
+    {
+        auto row = static_cast<uint8_t*>(bmp->pixels) + y * bmp->pitch;
+        auto historyRow = static_cast<const uint8_t*>(history->pixels) + y * history->pitch;
+        for (int tileX = 0; tileX < rates.tilesX; ++tileX)
+        {
+            if ( rates.get(tileX, y / RateMap::c_tileSize) == 0 )
+            {
+                int x = tileX * RateMap::c_tileSize;
+                int width = std::min(RateMap::c_tileSize, bmp->w - x);
+                memcpy(row + x * bytesPerPixel, historyRow + x * bytesPerPixel, width * bytesPerPixel);
+            }
+        }
+    }
+}
+
+//! Progress of a frame rendered coarse to fine.
+struct ProgressiveState
+{
+    //! Index of the current pass in c_progressivePasses.
+    int pass;
+    //! Rows of the current pass done so far.
+    std::vector<uint8_t> rowsDone;
+    //! Pixels shaded in all the passes.
+    uint64_t pixels;
+
+    ProgressiveState()
+        : pass(0)
+        , pixels(0)
+    {}
+};
+
+//! Renders the frame coarse to fine (see c_progressivePasses) until it is complete, the deadline
+//! passes or drawing gets cancelled; can be called again to carry on from where it stopped.
+//! \return Fraction of the frame's pixels shaded so far.
+static double renderProgressive(SDL_Surface* bmp, ProgressiveState& state, RenderClock::time_point deadline, int frameIndex, FrameStats& stats)
+{
+    while ( state.pass < c_progressivePassCount && !g_cancelDraw )
+    {
+        auto& layout = c_progressivePasses[state.pass];
+        if ( state.rowsDone.empty() )
+        {
+            state.rowsDone.resize(getPassRowCount(layout, bmp->h));
+        }
+
+        {
+            TRACE_SCOPE("pass", "step", layout.step);
+            uint64_t pixelsBefore = stats.pixels;
+            shadePass(bmp, layout, frameIndex, state.rowsDone, deadline, stats);
+            state.pixels += stats.pixels - pixelsBefore;
+        }
+
+        if ( std::find(state.rowsDone.begin(), state.rowsDone.end(), 0) != state.rowsDone.end() )
+        {
+            // out of time (or cancelled) in the middle of the pass
+            break;
+        }
+        ++state.pass;
+        state.rowsDone.clear();
+
+        if ( RenderClock::now() >= deadline )
+        {
+            break;
+        }
+    }
+
+    return state.pass == c_progressivePassCount ? 1.0 : state.pixels / double(static_cast<uint64_t>(bmp->w) * bmp->h);
+}
+
+//! Picks the scale of the render resolution so that frames take the target time; shading cost
+//! is assumed to be proportional to the number of pixels.
+struct ResolutionController
+{
+    //! Below that frames get too blurry to be useful.
+    static const double c_minScale;
+
+    double scale;
+
+    ResolutionController()
+        : scale(1)
+    {}
+
+    void update(double frameTime, double targetTime)
+    {
+        double ratio = targetTime / std::max(frameTime, 1e-6);
+        // some slack, so that the resolution doesn't change with every frame
+        if ( ratio > 0.9 && ratio < 1.1 )
+        {
+            return;
+        }
+        // pixel count goes with the square of the scale; steps are limited, as single frames may be off
+        double factor = std::min(std::max(std::sqrt(ratio), 0.8), 1.25);
+        scale = std::min(std::max(scale * factor, c_minScale), 1.0);
+    }
+};
+const double ResolutionController::c_minScale = 0.25;
+
+//! Thread used for rendering; it invokes the shader
+static int renderThread(void*)
+{
+    int frameIndex = 0;
+    unsigned renderSlot = g_renderSlot;
+
+    // progressive rendering is only worth it when the picture changes abruptly: at the start,
+    // after a resize or when the previous frame got cancelled
+    bool restarted = true;
+    int lastWidth = 0;
+    int lastHeight = 0;
+
+    ResolutionController resolutionController;
+    //! The last published frame; -1 if none.
+    int historySlot = -1;
+    //! Params of the last published frame and how its tiles were shaded (empty if unknown).
+    FrameParams historyParams = FrameParams();
+    RateMap historyRates;
+    //! Uniforms each tile of the last published frame depends on; empty if not tracked (i.e. all of them).
+    std::vector<unsigned> historyDependencies;
+    //! Params uniforms were last set from; frame constants are computed again only if these change.
+    FrameParams uniformsParams = FrameParams();
+
+    // publishes the slot and carries on with whatever was in the ready slot (presented or not);
+    // when rendering directly, slots only carry stats
+    auto publish = [&]() -> void
+    {
+        TRACE_SCOPE("publish", "frame", frameIndex);
+        renderSlot = g_readySlot.exchange(renderSlot | c_freshFrameBit) & ~c_freshFrameBit;
+        g_renderSlot = renderSlot;
+        SDL_SemPost( g_frameReadySemaphore.get() );
+    };
+
+    while (true)
+    {
+        // the screen can't be presented or resized while being drawn on
+        if ( g_renderDirect )
+        {
+            SDL_LockMutex(g_screenMutex.get());
+        }
+
+        SDL_Surface* bmp = nullptr;
+        FrameParams params;
+        {
+            // take what the main thread has set; uniforms can be changed only here, when no shader is running
+            TRACE_SCOPE("frame setup");
+            ScopedLock lock(g_sharedStateMutex);
             if ( g_quit )
             {
+                if ( g_renderDirect )
+                {
+                    SDL_UnlockMutex(g_screenMutex.get());
+                }
                 return 0;
             }
+            g_cancelDraw = false;
+
+            params = g_frameParams;
+            restarted |= params.width != lastWidth || params.height != lastHeight;
+            lastWidth = params.width;
+            lastHeight = params.height;
+            if ( g_targetFrameTime.count() )
+            {
+                // never the case when rendering directly, as the frame needs to be stretched
+                params.width = std::max(1, static_cast<int>(params.width * resolutionController.scale + 0.5));
+                params.height = std::max(1, static_cast<int>(params.height * resolutionController.scale + 0.5));
+            }
+
+            if ( params.directSurface )
+            {
+                bmp = params.directSurface;
+            }
+            else
+            {
+                auto& slot = g_frameSlots[renderSlot];
+                if ( !prepareSlot(slot, params) )
+                {
+                    std::cerr << "ERROR: Unable to create surface" << std::endl;
+                    g_quit = g_cancelDraw = true;
+                    return 1;
+                }
+                bmp = slot.surface.get();
+            }
+
+            glsl_sandbox::time = params.time;
+            glsl_sandbox::mouse = params.mouse;
+            glsl_sandbox::resolution.x = static_cast<float>(params.width);
+            glsl_sandbox::resolution.y = static_cast<float>(params.height);
+#if defined(USE_TRACKING)
+            // tag uniforms, so that it's known what each tile depends on
+            auto tag = [](float_type& value, unsigned dependency) -> void
+            {
+                auto raw = static_cast<raw_float_type>(value);
+                raw.dependencies = dependency;
+                value = raw;
+            };
+            tag(glsl_sandbox::time, c_timeDependency);
+            tag(glsl_sandbox::mouse.x, c_mouseDependency);
+            tag(glsl_sandbox::mouse.y, c_mouseDependency);
+            tag(glsl_sandbox::resolution.x, c_resolutionDependency);
+            tag(glsl_sandbox::resolution.y, c_resolutionDependency);
+#endif
+            if ( params.timeVersion != uniformsParams.timeVersion || params.mouseVersion != uniformsParams.mouseVersion ||
+                 params.width != uniformsParams.width || params.height != uniformsParams.height )
+            {
+                swizzle::glsl::uniform_generation::next();
+                uniformsParams = params;
+            }
+        }
+
+        ++frameIndex;
+
+        FrameStats frameStats;
+        double coverage = 1;
+        auto frameStart = RenderClock::now();
+        // how tiles of this frame got shaded and what they depend on
+        RateMap frameRates;
+        std::vector<unsigned> frameDependencies;
+        // nothing to shade, the last frame is as good as it gets
+        bool unchanged = false;
+        if ( g_progressiveBudget.count() && restarted )
+        {
+            // never the case when rendering directly, previews need slots
+            ProgressiveState progress;
+            while ( (coverage = renderProgressive(bmp, progress, RenderClock::now() + g_progressiveBudget, frameIndex, frameStats)) < 1 && !g_cancelDraw )
+            {
+                // show what's done so far and carry on with a copy of it
+                auto& slot = g_frameSlots[renderSlot];
+                slot.index = frameIndex;
+                slot.preview = true;
+                slot.coverage = coverage;
+                publish();
+
+                ScopedLock lock(g_sharedStateMutex);
+                auto& nextSlot = g_frameSlots[renderSlot];
+                if ( !prepareSlot(nextSlot, params) )
+                {
+                    std::cerr << "ERROR: Unable to create surface" << std::endl;
+                    g_quit = g_cancelDraw = true;
+                    return 1;
+                }
+                memcpy(nextSlot.surface->pixels, bmp->pixels, static_cast<size_t>(bmp->pitch) * bmp->h);
+                bmp = nextSlot.surface.get();
+            }
+            frameRates = RateMap(bmp->w, bmp->h);
+#if defined(USE_TRACKING)
+            frameDependencies = frameStats.tileDependencies;
+#endif
+        }
+        else
+        {
+            // the last published frame is read only until the next one gets published; after a
+            // restart it's too different to be of use
+            SDL_Surface* history = historySlot >= 0 ? g_frameSlots[historySlot].surface.get() : nullptr;
+            bool haveHistory = !restarted && history && history->w == bmp->w && history->h == bmp->h &&
+                               history->format->Rmask == bmp->format->Rmask && history->format->Gmask == bmp->format->Gmask && history->format->Bmask == bmp->format->Bmask;
+            bool interleave = g_interleave > 1 && haveHistory;
+
+            auto layout = interleave ? getInterleavedLayout(g_interleave, frameIndex) : c_fullFrame;
+            std::unique_ptr<RateMap> rateMap;
+            if ( !g_rateImage.pixels.empty() )
+            {
+                rateMap.reset(new RateMap(RateMap::fromImage(g_rateImage, bmp->w, bmp->h)));
+            }
+            else if ( g_autoRates && haveHistory && frameIndex % c_autoRatesRefreshInterval != 0 )
+            {
+                TRACE_SCOPE("shading rates");
+                rateMap.reset(new RateMap(RateMap::fromContrast(history)));
+            }
+            else if ( g_foveate )
+            {
+                // the focus is in window pixels, the frame may be scaled
+                SDL_Rect focus = params.focus;
+                double scale = params.width / static_cast<double>(lastWidth);
+                focus.x = static_cast<Sint16>(focus.x * scale);
+                focus.y = static_cast<Sint16>(focus.y * scale);
+                focus.w = static_cast<Uint16>(focus.w * scale);
+                focus.h = static_cast<Uint16>(focus.h * scale);
+                rateMap.reset(new RateMap(RateMap::fromFocus(bmp->w, bmp->h, focus)));
+            }
+
+            // tiles that don't depend on uniforms that changed (with dependencies untracked: while uniforms
+            // hold still) and are already shaded at least as finely are kept, so only the dirty ones get shaded
+            unsigned changedUniforms = 0;
+            if ( params.timeVersion != historyParams.timeVersion )
+            {
+                changedUniforms |= c_timeDependency;
+            }
+            if ( params.mouseVersion != historyParams.mouseVersion )
+            {
+                changedUniforms |= c_mouseDependency;
+            }
+            bool reuse = false;
+            if ( !interleave && haveHistory && !historyRates.rates.empty() )
+            {
+                RateMap keptRates = rateMap ? *rateMap : RateMap(bmp->w, bmp->h);
+                for (size_t i = 0; i < keptRates.rates.size(); ++i)
+                {
+                    unsigned dependencies = historyDependencies.empty() ? c_allDependencies : historyDependencies[i];
+                    if ( historyRates.rates[i] <= keptRates.rates[i] && (dependencies & changedUniforms) == 0 )
+                    {
+                        keptRates.rates[i] = 0;
+                        reuse = true;
+                    }
+                }
+                if ( reuse )
+                {
+                    rateMap.reset(new RateMap(std::move(keptRates)));
+                    unchanged = std::count(rateMap->rates.begin(), rateMap->rates.end(), 0) == static_cast<ptrdiff_t>(rateMap->rates.size());
+                    if ( !unchanged )
+                    {
+                        copyKeptTiles(bmp, history, *rateMap);
+                    }
+                }
+            }
+            layout.rates = rateMap.get();
+
+            if ( !unchanged )
+            {
+                std::vector<uint8_t> rowsDone(getPassRowCount(layout, bmp->h));
+                shadePass(bmp, layout, frameIndex, rowsDone, RenderClock::time_point::max(), frameStats);
+                if ( interleave && !g_cancelDraw )
+                {
+                    reconstruct(bmp, layout, history);
+                }
+            }
+
+            // interleaved frames are mixes of several, so their rates are unknown
+            if ( !interleave )
+            {
+                frameRates = rateMap ? *rateMap : RateMap(bmp->w, bmp->h);
+#if defined(USE_TRACKING)
+                frameDependencies = frameStats.tileDependencies;
+                frameDependencies.resize(frameRates.rates.size(), 0);
+#endif
+                for (size_t i = 0; reuse && i < frameRates.rates.size(); ++i)
+                {
+                    if ( frameRates.rates[i] == 0 )
+                    {
+                        frameRates.rates[i] = historyRates.rates[i];
+                        if ( !frameDependencies.empty() )
+                        {
+                            frameDependencies[i] = historyDependencies.empty() ? c_allDependencies : historyDependencies[i];
+                        }
+                    }
+                }
+            }
+
+            if ( g_targetFrameTime.count() && !g_cancelDraw && !reuse )
+            {
+                // progressive frames are not representative, with all the previews, nor are ones reusing tiles
+                typedef std::chrono::duration<double, std::milli> Milliseconds;
+                resolutionController.update(Milliseconds(RenderClock::now() - frameStart).count(), Milliseconds(g_targetFrameTime).count());
+            }
+        }
+        restarted = g_cancelDraw;
+
+        if ( g_renderDirect )
+        {
+            SDL_UnlockMutex(g_screenMutex.get());
+        }
+
+        // incomplete frames are not shown
+        if ( !g_cancelDraw && !unchanged )
+        {
+            auto& slot = g_frameSlots[renderSlot];
+            slot.index = frameIndex;
+            slot.preview = false;
+            slot.coverage = coverage;
+            slot.stats = frameStats;
+            g_shaderPerf += frameStats.perf;
+            g_shaderPixels += frameStats.pixels;
+            ++g_shaderFrames;
+            historySlot = static_cast<int>(renderSlot);
+            historyParams = params;
+            historyRates = std::move(frameRates);
+            historyDependencies = std::move(frameDependencies);
+            publish();
+        }
+        else if ( unchanged )
+        {
+            // don't spin while waiting for uniforms to change
+            SDL_Delay(1);
+        }
+
+        if ( g_renderDirect )
+        {
+            // leave the screen alone until the frame is presented (or the screen resized)
+            TRACE_SCOPE("wait for present", "frame", frameIndex);
+            while ( !g_quit && SDL_SemWaitTimeout(g_framePresentedSemaphore.get(), 33) != 0 )
+            {}
+            while ( SDL_SemTryWait(g_framePresentedSemaphore.get()) == 0 )
+            {}
         }
     }
 }
@@ -348,19 +1423,106 @@ extern "C" int main(int argc, char* argv[])
     }
 #endif
 
-    // get initial resolution
+    // parse arguments: [--trace <file.json>] [--golden <file.ppm>] [--direct] [--progressive <ms>] [--target-ms <ms>] [--interleave <2|4>] [--vrs <auto|map.pgm>] [--foveate] [--roi x,y,w,h] [initial resolution]
     swizzle::glsl::vector<int, 2> initialResolution;
     initialResolution.x = 128;
     initialResolution.y = 128;
-    if (argc == 2)
+    const char* tracePath = nullptr;
+    const char* goldenPath = nullptr;
+    swizzle::glsl::vector<int, 4> roi(0, 0, 0, 0);
+    bool haveRoi = false;
+    for (int i = 1; i < argc; ++i)
     {
-        std::stringstream s;
-        s << argv[1];
-        if ( !(s >> initialResolution) )
+        std::string arg = argv[i];
+        if (arg == "--trace" || arg == "--golden")
+        {
+            if (++i == argc)
+            {
+                cerr << "ERROR: " << arg << " requires a file path" << endl;
+                return 1;
+            }
+            (arg == "--trace" ? tracePath : goldenPath) = argv[i];
+        }
+        else if (arg == "--direct")
+        {
+            g_renderDirect = true;
+        }
+        else if (arg == "--progressive" || arg == "--target-ms")
+        {
+            int ms = 0;
+            if (++i == argc || !(std::stringstream(argv[i]) >> ms) || ms <= 0)
+            {
+                cerr << "ERROR: " << arg << " requires a positive number of milliseconds" << endl;
+                return 1;
+            }
+            (arg == "--progressive" ? g_progressiveBudget : g_targetFrameTime) = std::chrono::milliseconds(ms);
+        }
+        else if (arg == "--vrs")
+        {
+            if (++i == argc)
+            {
+                cerr << "ERROR: " << arg << " requires \"auto\" or a rate map path" << endl;
+                return 1;
+            }
+            if (std::string(argv[i]) == "auto")
+            {
+                g_autoRates = true;
+            }
+            else if (!loadPPM(g_rateImage, argv[i]))
+            {
+                cerr << "ERROR: unable to load rate map " << argv[i] << endl;
+                return 1;
+            }
+        }
+        else if (arg == "--foveate")
+        {
+            g_foveate = true;
+        }
+        else if (arg == "--roi")
+        {
+            std::stringstream s;
+            if (++i < argc)
+            {
+                s << argv[i];
+            }
+            if (i == argc || !(s >> roi) || roi.x < 0 || roi.y < 0 || roi.z < 0 || roi.w < 0)
+            {
+                cerr << "ERROR: " << arg << " requires a rectangle: x,y,w,h" << endl;
+                return 1;
+            }
+            g_foveate = haveRoi = true;
+        }
+        else if (arg == "--interleave")
         {
-            cerr << "ERROR: unable to parse resolution argument" << endl;
-            return 1;
+            if (++i == argc || !(std::stringstream(argv[i]) >> g_interleave) || (g_interleave != 2 && g_interleave != 4))
+            {
+                cerr << "ERROR: " << arg << " requires 2 or 4" << endl;
+                return 1;
+            }
         }
+        else
+        {
+            std::stringstream s;
+            s << arg;
+            if ( !(s >> initialResolution) )
+            {
+                cerr << "ERROR: unable to parse resolution argument" << endl;
+                return 1;
+            }
+        }
+    }
+
+    if (tracePath)
+    {
+        // has to happen before any other thread starts
+        trace::enable();
+        trace::setThreadName("main");
+    }
+
+    if ( (g_interleave > 1) + (g_autoRates || !g_rateImage.pixels.empty()) + g_foveate > 1 )
+    {
+        cerr << "ERROR: --interleave, --vrs and --foveate (--roi) can't be combined" << endl;
+        return 1;
     }
 
     if ( initialResolution.x <= 0 || initialResolution.y < 0 )
@@ -373,36 +1535,41 @@ extern "C" int main(int argc, char* argv[])
     cout << "+/-   - increase/decrease time scale\n";
     cout << "lmb   - update glsl_sandbox::mouse\n";
     cout << "space - blit now! (show incomplete render)\n";
-    cout << "esc   - quit\n\n";
+    cout << "p     - pause/resume time; while uniforms don't change, only tiles that need a finer rate get shaded\n";
+    cout << "esc   - quit\n";
+    cout << "--trace <file.json> - record a timeline viewable in chrome://tracing or Perfetto\n";
+    cout << "--golden <file.ppm> - render a single frame at time 1 and save it as the golden image or,\n"
+            "                      if it exists, compare against it (differences go to <file.ppm>.diff.ppm)\n";
+    cout << "--direct            - render straight to the screen; saves a copy per frame, but rendering\n"
+            "                      and presenting can't overlap\n";
+    cout << "--progressive <ms>  - after a restart (start, resize, mouse drag) render 1/16 of pixels, then\n"
+            "                      1/4, then the rest, showing what's done every <ms>\n";
+    cout << "--target-ms <ms>    - lower the render resolution (down to 1/4 of the window's) so that\n"
+            "                      frames take about <ms>, stretching them to the window\n";
+    cout << "--interleave <2|4>  - shade 1/2 (checkerboard) or 1/4 of pixels per frame, reconstructing\n"
+            "                      the rest from the previous frame\n";
+    cout << "--vrs <auto|map.pgm> - shade a pixel per 2x2 or 4x4 block in 16x16 tiles of low contrast in\n"
+            "                      the previous frame, or as the map says (white: 1x1, grey: 2x2, black: 4x4)\n";
+    cout << "--foveate           - shade at full rate only around the cursor, falling off to 2x2 and 4x4\n";
+    cout << "--roi x,y,w,h       - as above, around a rectangle (window pixels, top-left origin)\n\n";
 
     // it doesn't need cleaning up
     SDL_Surface* screen = nullptr;
+    int exitCode = 0;
 
     try 
     {
         // a function to resize the screen; throws if unsuccessful
         auto resizeOrCreateScreen = [&](int w, int h) -> void
         {
-            screen = SDL_SetVideoMode( w, h, 24, SDL_SWSURFACE | SDL_RESIZABLE);
+            // 32 bits, so that frames can be written with SIMD stores and copied without conversion
+            screen = SDL_SetVideoMode( w, h, 32, SDL_SWSURFACE | SDL_RESIZABLE);
             if ( !screen )
             {
                 throw std::runtime_error("Unable to set video mode");
             }
         };
 
-        // a function used to resize the surface
-        auto resizeOrCreateSurface = [&](int w, int h) -> void
-        {
-            g_surface.reset( SDL_CreateRGBSurface(SDL_SWSURFACE, w, h, 24, 0x000000ff, 0x0000ff00, 0x00ff0000, 0 ) );
-            if ( !g_surface )
-            {
-                throw std::runtime_error("Unable to create surface");
-            }
-            // update shader value
-            glsl_sandbox::resolution.x = static_cast<float>(w);
-            glsl_sandbox::resolution.y = static_cast<float>(h);
-        };
-
         // initial setup
         if (SDL_Init( SDL_INIT_VIDEO ) < 0 )
         {
@@ -412,25 +1579,128 @@ extern "C" int main(int argc, char* argv[])
         SDL_WM_SetCaption("SDL/Swizzle", "SDL/Swizzle");
 
         resizeOrCreateScreen(initialResolution.x, initialResolution.y);
-        resizeOrCreateSurface(initialResolution.x, initialResolution.y);
+        if ( g_renderDirect && (SDL_MUSTLOCK(screen) || screen->format->BytesPerPixel != 4) )
+        {
+            cerr << "WARNING: can't render directly to the screen, falling back to blitting" << endl;
+            g_renderDirect = false;
+        }
+        if ( g_renderDirect && (g_progressiveBudget.count() || g_targetFrameTime.count() || g_interleave > 1 || g_autoRates) )
+        {
+            // the screen can't be refined while it is being presented, nor can it be stretched or
+            // serve as the previous frame
+            cerr << "WARNING: progressive, scaled, interleaved and automatic variable rate rendering need blitting, ignoring --direct" << endl;
+            g_renderDirect = false;
+        }
         
         float timeScale = 1;
         int frame = 0;
         float time = 0;
-        vec2 mousePosition(0, 0);
-        bool pendingResize = false;
+        glsl_sandbox::uniforms::vec2 mousePosition(0, 0);
         bool mousePressed = false;
+        bool paused = false;
+        bool mouseMoved = false;
+        SDL_Rect cursor = { 0, 0, 0, 0 };
 
+        if (goldenPath)
+        {
+            // freeze time at the initial value of glsl_sandbox::time, so that frames are comparable
+            time = 1;
+            timeScale = 0;
+        }
+
+        // passes current values to the render thread; they are used from the next frame on, unless
+        // restart is set, in which case the current frame gets dropped
+        auto updateFrameParams = [&](bool restart) -> void
+        {
+            TRACE_SCOPE("update uniforms");
+            ScopedLock lock(g_sharedStateMutex);
+            g_frameParams.mouse = mousePosition / glsl_sandbox::uniforms::vec2(screen->w, screen->h);
+            g_frameParams.width = screen->w;
+            g_frameParams.height = screen->h;
+            if ( screen->format->BytesPerPixel == 4 )
+            {
+                g_frameParams.rmask = screen->format->Rmask;
+                g_frameParams.gmask = screen->format->Gmask;
+                g_frameParams.bmask = screen->format->Bmask;
+            }
+            else
+            {
+                g_frameParams.rmask = 0x00ff0000;
+                g_frameParams.gmask = 0x0000ff00;
+                g_frameParams.bmask = 0x000000ff;
+            }
+            g_frameParams.directSurface = g_renderDirect ? screen : nullptr;
+            if ( time != g_frameParams.time )
+            {
+                ++g_frameParams.timeVersion;
+            }
+            if ( mouseMoved )
+            {
+                ++g_frameParams.mouseVersion;
+                mouseMoved = false;
+            }
+            g_frameParams.time = time;
+            if ( haveRoi )
+            {
+                g_frameParams.focus.x = static_cast<Sint16>(roi.x);
+                g_frameParams.focus.y = static_cast<Sint16>(roi.y);
+                g_frameParams.focus.w = static_cast<Uint16>(roi.z);
+                g_frameParams.focus.h = static_cast<Uint16>(roi.w);
+            }
+            else
+            {
+                g_frameParams.focus = cursor;
+            }
+            if ( restart )
+            {
+                // under the lock, so that the frame started with these params is not the one dropped
+                g_cancelDraw = true;
+            }
+        };
 
+        // frames rendered at a different resolution (scaled down or from before a resize) get stretched
+        auto blitToScreen = [&](SDL_Surface* frame) -> void
+        {
+            TRACE_SCOPE("blit");
+            if ( (frame->w == screen->w && frame->h == screen->h) || SDL_SoftStretch( frame, NULL, screen, NULL ) < 0 )
+            {
+                SDL_BlitSurface( frame, NULL, screen, NULL );
+            }
+        };
+
+        // waits for the render thread to complete a frame
+        auto waitForFrame = [&]() -> void
+        {
+            TRACE_SCOPE("wait for frame");
+            if ( SDL_SemWaitTimeout(g_frameReadySemaphore.get(), 33) == 0 )
+            {
+                // frames might have been picked up without waiting
+                while ( SDL_SemTryWait(g_frameReadySemaphore.get()) == 0 )
+                {}
+            }
+        };
+
+        updateFrameParams(false);
         auto renderThreadInstance = SDL_CreateThread(renderThread, nullptr);
 
+        // the slot being presented
+        unsigned presentSlot = 2;
+        int lastFrameIndex = 0;
+
         clock_t begin = clock();
         clock_t frameBegin = begin;
         float lastFPS = 0;
+        float lastMPixels = 0;
+        std::string lastPerf;
+        double lastCoverage = 1;
+        double lastScale = 1;
 
         while (!g_quit) 
         {
+            TRACE_SCOPE("main loop");
             bool blitNow = false;
+            // progressively rendered frames can be restarted cheaply, so dragging the mouse does it
+            bool restartFrame = false;
 
             // process events
             SDL_Event event;
@@ -441,16 +1711,26 @@ extern "C" int main(int argc, char* argv[])
                 case SDL_VIDEORESIZE:
                     if ( event.resize.w != screen->w || event.resize.h != screen->h )
                     {
+                        {
+                            // the render thread resizes its surfaces when it starts a new frame, clearing the
+                            // flag under this lock; released before taking the screen mutex, which it locks first
+                            ScopedLock lock(g_sharedStateMutex);
+                            g_cancelDraw = true;
+                        }
+                        // ... or draws to the screen, in which case it needs to be stopped first
+                        ScopedLock lock(g_renderDirect ? g_screenMutex.get() : nullptr);
                         resizeOrCreateScreen( event.resize.w, event.resize.h );
-                        ScopedLock lock(g_frameHandshakeMutex);
-                        g_cancelDraw = pendingResize = true;
+                        if ( g_renderDirect )
+                        {
+                            updateFrameParams(false);
+                            // a frame still waiting is of the old screen
+                            g_readySlot &= ~c_freshFrameBit;
+                            SDL_SemPost( g_framePresentedSemaphore.get() );
+                        }
                     }
                     break;
                 case SDL_QUIT:
-                    {
-                        ScopedLock lock(g_frameHandshakeMutex);
-                        g_quit = g_cancelDraw = true;
-                    }
+                    g_quit = g_cancelDraw = true;
                     break; 
                 case SDL_KEYDOWN:
                     switch ( event.key.keysym.sym ) 
@@ -459,10 +1739,7 @@ extern "C" int main(int argc, char* argv[])
                         blitNow = true;
                         break;
                     case SDLK_ESCAPE:
-                        {
-                            ScopedLock lock(g_frameHandshakeMutex);
-                            g_quit = g_cancelDraw = true;
-                        }
+                        g_quit = g_cancelDraw = true;
                         break;
                     case SDLK_PLUS:
                     case SDLK_EQUALS:
@@ -471,6 +1748,9 @@ extern "C" int main(int argc, char* argv[])
                     case SDLK_MINUS:
                         timeScale /= 2.0f;
                         break;
+                    case SDLK_p:
+                        paused = !paused;
+                        break;
                     default:
                         break;
                     }
@@ -479,13 +1759,19 @@ extern "C" int main(int argc, char* argv[])
                     if (mousePressed)
                     {
                         mousePosition.x = static_cast<float>(event.button.x);
-                        mousePosition.y = static_cast<float>(g_surface->h - 1 - event.button.y);
+                        mousePosition.y = static_cast<float>(screen->h - 1 - event.button.y);
+                        restartFrame = g_progressiveBudget.count() != 0;
+                        mouseMoved = true;
                     }
+                    cursor.x = static_cast<Sint16>(event.motion.x);
+                    cursor.y = static_cast<Sint16>(event.motion.y);
                     break;
                 case SDL_MOUSEBUTTONDOWN:
                     mousePressed = true;
                     mousePosition.x = static_cast<float>(event.button.x);
-                    mousePosition.y = static_cast<float>(g_surface->h - 1 - event.button.y);
+                    mousePosition.y = static_cast<float>(screen->h - 1 - event.button.y);
+                    restartFrame = g_progressiveBudget.count() != 0;
+                    mouseMoved = true;
                     break;
                 case SDL_MOUSEBUTTONUP:
                     mousePressed = false;
@@ -494,44 +1780,71 @@ extern "C" int main(int argc, char* argv[])
                 }
             }
 
+            if ( g_quit )
+            {
+                break;
+            }
+
+            updateFrameParams(restartFrame);
+
             bool doFlip = false;
+            bool presentedFrame = false;
+            if ( blitNow )
             {
-                ScopedLock lock(g_frameHandshakeMutex);
-                if ( g_quit )
+                // show the frame being rendered, as it is; the lock keeps the surface from being resized
+                ScopedLock lock(g_sharedStateMutex);
+                auto& slot = g_frameSlots[g_renderSlot];
+                if ( g_renderDirect )
                 {
-                    if ( g_frameReady )
-                    {
-                        // unlock waiting thread
-                        SDL_CondSignal( m_frameReceivedEvent.get() );
-                    }
+                    doFlip = true;
                 }
-                // if either the flag is set or variable has been signaled do the blit
-                else if ( blitNow || g_frameReady || SDL_CondWaitTimeout(m_frameReadyEvent.get(), g_frameHandshakeMutex.get(), 33) == 0 )
+                else if ( slot.surface )
                 {
+                    blitToScreen( slot.surface.get() );
                     doFlip = true;
-                    SDL_BlitSurface( g_surface.get(), NULL, screen, NULL );
+                }
+            }
+            else
+            {
+                if ( !(g_readySlot & c_freshFrameBit) )
+                {
+                    waitForFrame();
+                }
 
-                    if ( pendingResize )
+                if ( g_readySlot & c_freshFrameBit )
+                {
+                    // take the latest frame, give back the presented one
+                    presentSlot = g_readySlot.exchange(presentSlot) & ~c_freshFrameBit;
+                    auto& slot = g_frameSlots[presentSlot];
+                    doFlip = presentedFrame = true;
+                    if ( !g_renderDirect )
                     {
-                        resizeOrCreateSurface(screen->w, screen->h);
-                        pendingResize = false;
+                        blitToScreen( slot.surface.get() );
+                        lastScale = slot.surface->w / static_cast<double>(screen->w);
                     }
 
-                    if (g_frameReady)
+                    lastCoverage = slot.coverage;
+                    // previews don't carry stats, they come with the complete frame
+                    if ( !slot.preview )
                     {
+                        // frames might have been skipped, if rendered faster than presented
                         auto currClock = clock();
-                        lastFPS = 1.0f / static_cast<float>((currClock - frameBegin) / double(CLOCKS_PER_SEC));
+                        lastFPS = (slot.index - lastFrameIndex) / static_cast<float>((currClock - frameBegin) / double(CLOCKS_PER_SEC));
+                        lastFrameIndex = slot.index;
                         frameBegin = currClock;
+                        lastMPixels = lastFPS * slot.stats.pixels / 1000000.0f;
+                        lastPerf = formatPerfSample(slot.stats.perf, slot.stats.pixels);
+#if defined(USE_COUNTING)
+                        printOpStats(cout, slot.stats.opStats);
+#endif
                     }
-
-                    if (!blitNow || g_frameReady)
+                    if (goldenPath && !slot.preview)
                     {
-                        // transfer variables (resolution is transfered elsewhere)
-                        glsl_sandbox::time = time;
-                        glsl_sandbox::mouse = mousePosition / vec2(screen->w, screen->h);
-                        // reset flags
-                        g_cancelDraw = g_frameReady = false;
-                        SDL_CondSignal( m_frameReceivedEvent.get() );
+                        if (!processGoldenImage(g_renderDirect ? screen : slot.surface.get(), goldenPath))
+                        {
+                            exitCode = 1;
+                        }
+                        g_quit = g_cancelDraw = true;
                     }
                 }
             }
@@ -539,20 +1852,55 @@ extern "C" int main(int argc, char* argv[])
             if (doFlip)
             {
                 ++frame;
-                SDL_Flip( screen );
+                TRACE_SCOPE("flip", "frame", frame);
+                {
+                    // when rendering directly, the render thread is waiting for this (unless showing an incomplete frame)
+                    ScopedLock lock(g_renderDirect && !blitNow ? g_screenMutex.get() : nullptr);
+                    SDL_Flip( screen );
+                }
+                if ( g_renderDirect && presentedFrame )
+                {
+                    SDL_SemPost( g_framePresentedSemaphore.get() );
+                }
             }
 
-            cout << "frame: " << frame << "\t time: " << time << "\t timescale: " << timeScale << "\t fps: " << lastFPS << "     \r";
+            cout << "frame: " << frame << "\t time: " << time << "\t timescale: " << timeScale << "\t fps: " << lastFPS << "\t Mpix/s: " << lastMPixels;
+            if ( g_progressiveBudget.count() )
+            {
+                cout << "\t coverage: " << static_cast<int>(lastCoverage * 100) << "%";
+            }
+            if ( g_targetFrameTime.count() )
+            {
+                cout << "\t scale: " << lastScale;
+            }
+            cout << "\t " << lastPerf << "     \r";
             cout.flush();
 
             clock_t delta = clock() - begin;
-            time += static_cast<float>(delta / double(CLOCKS_PER_SEC) * timeScale);
+            if ( !paused )
+            {
+                time += static_cast<float>(delta / double(CLOCKS_PER_SEC) * timeScale);
+            }
             begin = clock();
         }
 
         // wait for the render thread to stop
         cout << "\nwaiting for the worker thread to finish...";
         SDL_WaitThread(renderThreadInstance, nullptr);
+
+        cout << "\n" << SHADER_FILE << ": " << g_shaderFrames << " frames, " << formatPerfSample(g_shaderPerf, g_shaderPixels) << endl;
+
+        if (tracePath)
+        {
+            if (trace::dump(tracePath))
+            {
+                cout << "trace saved to " << tracePath << endl;
+            }
+            else
+            {
+                cerr << "ERROR: unable to save trace to " << tracePath << endl;
+            }
+        }
     } 
     catch ( exception& error ) 
     {
@@ -564,7 +1912,7 @@ extern "C" int main(int argc, char* argv[])
     }
 
     SDL_Quit();
-    return 0; 
+    return exitCode; 
 }
 
 
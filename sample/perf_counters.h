@@ -0,0 +1,257 @@
+// CxxSwizzle
+// Copyright (c) 2013-2015, Piotr Gwiazdowski <gwiazdorrr+github at gmail.com>
+#pragma once
+
+// Hardware performance counters of the calling thread, using Linux perf_event_open. Counters that
+// can't be opened (other OSes, lack of permissions - see /proc/sys/kernel/perf_event_paranoid -
+// virtual machines, unsupported events) are simply reported as unavailable. If there are more events
+// than hardware counters the kernel multiplexes them; such values are scaled up by the share of time
+// they were counted and reported as estimates.
+
+#include <cstdint>
+#include <algorithm>
+#include <string>
+#include <sstream>
+#include <iomanip>
+
+#if defined(__linux__)
+#include <cstring>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#if defined(__i386__) || defined(__x86_64__)
+#include <cpuid.h>
+#endif
+#endif
+
+enum PerfEvent
+{
+    PerfCycles,
+    PerfInstructions,
+    PerfL1DMisses,
+    PerfLLCMisses,
+    PerfBranchMisses,
+    // FP_ARITH_INST_RETIRED, single precision; Intel Broadwell and newer only
+    PerfFpScalar,
+    PerfFp128,
+    PerfFp256,
+    PerfFp512,
+    PerfEventCount
+};
+
+inline const char* getPerfEventName(PerfEvent e)
+{
+    static const char* const names[PerfEventCount] =
+    {
+        "cycles", "instructions", "L1D misses", "LLC misses", "branch misses",
+        "fp scalar", "fp 128b", "fp 256b", "fp 512b"
+    };
+    return names[e];
+}
+
+//! Counter values accumulated over a piece of work.
+struct PerfSample
+{
+    uint64_t values[PerfEventCount];
+    //! Bit per PerfEvent.
+    unsigned availableMask;
+    //! Bit per PerfEvent that was counted only part of the time and so is an estimate.
+    unsigned multiplexedMask;
+
+    PerfSample()
+        : availableMask(0)
+        , multiplexedMask(0)
+    {
+        std::fill(values, values + PerfEventCount, uint64_t(0));
+    }
+
+    bool isAvailable(PerfEvent e) const
+    {
+        return (availableMask & (1u << e)) != 0;
+    }
+
+    bool isMultiplexed(PerfEvent e) const
+    {
+        return (multiplexedMask & (1u << e)) != 0;
+    }
+
+    PerfSample& operator+=(const PerfSample& other)
+    {
+        for (int i = 0; i < PerfEventCount; ++i)
+        {
+            values[i] += other.values[i];
+        }
+        availableMask |= other.availableMask;
+        multiplexedMask |= other.multiplexedMask;
+        return *this;
+    }
+};
+
+#if defined(__linux__)
+
+class PerfCounters
+{
+public:
+    PerfCounters()
+    {
+        bool isIntel = false;
+#if defined(__i386__) || defined(__x86_64__)
+        unsigned eax, ebx, ecx, edx;
+        if (__get_cpuid(0, &eax, &ebx, &ecx, &edx))
+        {
+            isIntel = ebx == 0x756e6547 && edx == 0x49656e69 && ecx == 0x6c65746e; // "GenuineIntel"
+        }
+#endif
+        const uint64_t l1dReadMiss = PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+
+        m_fds[PerfCycles] = open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+        m_fds[PerfInstructions] = open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+        m_fds[PerfL1DMisses] = open(PERF_TYPE_HW_CACHE, l1dReadMiss);
+        m_fds[PerfLLCMisses] = open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+        m_fds[PerfBranchMisses] = open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+        // raw event codes mean different things on other vendors
+        m_fds[PerfFpScalar] = isIntel ? open(PERF_TYPE_RAW, 0x02C7) : -1;
+        m_fds[PerfFp128] = isIntel ? open(PERF_TYPE_RAW, 0x08C7) : -1;
+        m_fds[PerfFp256] = isIntel ? open(PERF_TYPE_RAW, 0x20C7) : -1;
+        m_fds[PerfFp512] = isIntel ? open(PERF_TYPE_RAW, 0x80C7) : -1;
+
+        std::fill(m_begin, m_begin + PerfEventCount, Reading());
+    }
+
+    ~PerfCounters()
+    {
+        for (int fd : m_fds)
+        {
+            if (fd >= 0)
+            {
+                close(fd);
+            }
+        }
+    }
+
+    //! Remembers current values.
+    void begin()
+    {
+        for (int i = 0; i < PerfEventCount; ++i)
+        {
+            m_begin[i] = readCounter(m_fds[i]);
+        }
+    }
+
+    //! Adds values accumulated since begin() to the sample; values of multiplexed counters are
+    //! scaled by enabled / running time. Counters that didn't run at all are left out.
+    void end(PerfSample& sample)
+    {
+        for (int i = 0; i < PerfEventCount; ++i)
+        {
+            if (m_fds[i] >= 0)
+            {
+                Reading current = readCounter(m_fds[i]);
+                uint64_t value = current.value - m_begin[i].value;
+                uint64_t enabled = current.enabled - m_begin[i].enabled;
+                uint64_t running = current.running - m_begin[i].running;
+                if (running == 0)
+                {
+                    continue;
+                }
+                if (running < enabled)
+                {
+                    value = static_cast<uint64_t>(value * (enabled / double(running)) + 0.5);
+                    sample.multiplexedMask |= 1u << i;
+                }
+                sample.values[i] += value;
+                sample.availableMask |= 1u << i;
+            }
+        }
+    }
+
+private:
+    //! Layout of read() with PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING.
+    struct Reading
+    {
+        uint64_t value;
+        uint64_t enabled;
+        uint64_t running;
+
+        Reading()
+            : value(0)
+            , enabled(0)
+            , running(0)
+        {}
+    };
+
+    int m_fds[PerfEventCount];
+    Reading m_begin[PerfEventCount];
+
+    static int open(uint32_t type, uint64_t config)
+    {
+        perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = type;
+        attr.config = config;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        // this thread, any cpu
+        return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+    }
+
+    static Reading readCounter(int fd)
+    {
+        Reading reading;
+        if (fd >= 0 && read(fd, &reading, sizeof(reading)) != sizeof(reading))
+        {
+            reading = Reading();
+        }
+        return reading;
+    }
+
+    // non-copyable
+    PerfCounters(const PerfCounters&);
+    PerfCounters& operator=(const PerfCounters&);
+};
+
+#else
+
+//! No counters on this platform.
+class PerfCounters
+{
+public:
+    void begin()
+    {}
+
+    void end(PerfSample&)
+    {}
+};
+
+#endif
+
+//! Short, one line summary: IPC and per pixel values of available counters; estimates of multiplexed
+//! counters are marked with '~'.
+inline std::string formatPerfSample(const PerfSample& sample, uint64_t pixels)
+{
+    if (!sample.availableMask || !pixels)
+    {
+        return "perf counters unavailable";
+    }
+
+    std::ostringstream os;
+    os << std::fixed << std::setprecision(2);
+    if (sample.isAvailable(PerfCycles) && sample.isAvailable(PerfInstructions) && sample.values[PerfCycles])
+    {
+        const bool estimate = sample.isMultiplexed(PerfCycles) || sample.isMultiplexed(PerfInstructions);
+        os << "IPC: " << (estimate ? "~" : "") << sample.values[PerfInstructions] / double(sample.values[PerfCycles]) << " ";
+    }
+    os << "per pixel:";
+    for (int i = 0; i < PerfEventCount; ++i)
+    {
+        if (sample.isAvailable(static_cast<PerfEvent>(i)))
+        {
+            os << " " << getPerfEventName(static_cast<PerfEvent>(i)) << " " << (sample.isMultiplexed(static_cast<PerfEvent>(i)) ? "~" : "") << sample.values[i] / double(pixels) << ",";
+        }
+    }
+    auto result = os.str();
+    result.pop_back();
+    return result;
+}
@@ -10,6 +10,11 @@ uniform vec2 resolution;
 
 const int MAX_ITER = 50;
 
+// values depending on uniforms only; computed once per frame where supported
+#ifndef FRAME_CONSTANT
+#define FRAME_CONSTANT(type, name, value) type name = value
+#endif
+
 vec2 rotate(in vec2 v, in float a) {
 	return vec2(cos(a)*v.x + sin(a)*v.y, -sin(a)*v.x + cos(a)*v.y);
 }
@@ -58,7 +63,8 @@ vec3 intersect(in vec3 rayOrigin, in vec3 rayDir)
 	vec3 p = rayOrigin;
 	float d = 1.0;
     float iter = 0;
-	float mind = 3.14159+sin(time*0.1)*0.2;
+	FRAME_CONSTANT(float, startMind, (3.14159+sin(time*0.1)*0.2));
+	float mind = startMind;
 	
 	for (int i = 0; i < MAX_ITER; i++)
 	{		
@@ -120,10 +126,10 @@ void main()
 {
 	vec3 upDirection = vec3(0, -1, 0);
 	vec3 cameraDir = vec3(1,0,0);
-	vec3 cameraOrigin = vec3(time*0.1, 0, 0);
+	FRAME_CONSTANT(vec3, cameraOrigin, (vec3(time*0.1, 0, 0)));
 	
-	vec3 u = normalize(cross(upDirection, cameraOrigin));
-	vec3 v = normalize(cross(cameraDir, u));
+	FRAME_CONSTANT(vec3, u, (normalize(cross(upDirection, cameraOrigin))));
+	FRAME_CONSTANT(vec3, v, (normalize(cross(cameraDir, u))));
 	vec2 screenPos = -1.0 + 2.0 * gl_FragCoord.xy / resolution.xy;
 	screenPos.x *= resolution.x / resolution.y;
 	vec3 rayDir = normalize(u * screenPos.x + v * screenPos.y + cameraDir*(1.0-length(screenPos)*0.5));
@@ -4,6 +4,11 @@
 //stereo thanks to Croqueteer
 //#define STEREO 
 
+// values depending on uniforms only; computed once per frame where supported
+#ifndef FRAME_CONSTANT
+#define FRAME_CONSTANT(type, name, value) type name = value
+#endif
+
 
 float hash( in float n )
 {
@@ -215,6 +220,20 @@ vec3 camPath( in float time )
 	return vec3( p.x, 0.0, p.y );
 }
 
+vec3 camPosition( in float time )
+{
+	vec3 ro = camPath( time );
+	ro.y = terrain3( ro.xz ) + 9.0;
+	return ro;
+}
+
+vec3 camTarget( in float time, in vec3 ro )
+{
+	vec3 ta = camPath( time + 3.0 );
+	ta.y = ro.y*0.35;
+	return ta;
+}
+
 void main(void)
 {
     vec2 xy = -1.0 + 2.0*gl_FragCoord.xy / iResolution.xy;
@@ -225,21 +244,19 @@ void main(void)
 	float isCyan = mod(gl_FragCoord.x + mod(gl_FragCoord.y,2.0),2.0);
     #endif
 	
-    float time = iGlobalTime*.15 + 2.0*iMouse.x/iResolution.x;
+    FRAME_CONSTANT(float, time, (iGlobalTime*.15 + 2.0*iMouse.x/iResolution.x));
 
 	vec3 light1 = normalize( vec3(  0.4, 0.22,  0.6 ) );
 
 
-	vec3 ro = camPath( time );
-	vec3 ta = camPath( time + 3.0 );
-	ro.y = terrain3( ro.xz ) + 9.0;
-	ta.y = ro.y*0.35;
+	FRAME_CONSTANT(vec3, ro, (camPosition( time )));
+	FRAME_CONSTANT(vec3, ta, (camTarget( time, ro )));
 
-	float cr = 0.2*cos(0.1*time);
-	vec3  cw = normalize(ta-ro);
-	vec3  cp = vec3(sin(cr), cos(cr),0.0);
-	vec3  cu = normalize( cross(cw,cp) );
-	vec3  cv = normalize( cross(cu,cw) );
+	FRAME_CONSTANT(float, cr, (0.2*cos(0.1*time)));
+	FRAME_CONSTANT(vec3, cw, (normalize(ta-ro)));
+	FRAME_CONSTANT(vec3, cp, (vec3(sin(cr), cos(cr),0.0)));
+	FRAME_CONSTANT(vec3, cu, (normalize( cross(cw,cp) )));
+	FRAME_CONSTANT(vec3, cv, (normalize( cross(cu,cw) )));
 	vec3  rd = normalize( s.x*cu + s.y*cv + 2.0*cw );
 
 	#ifdef STEREO
@@ -0,0 +1,211 @@
+// CxxSwizzle
+// Copyright (c) 2013-2015, Piotr Gwiazdowski <gwiazdorrr+github at gmail.com>
+#pragma once
+
+// A tiny tracer: each thread records complete events (name, begin, end, an optional argument) into
+// its own ring buffer, timestamped with TSC. The whole thing can be dumped as a Chrome trace-event
+// JSON file and viewed with chrome://tracing or Perfetto. When disabled, a scope costs a single branch.
+
+#include <cstdint>
+#include <algorithm>
+#include <chrono>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <fstream>
+#include <string>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__i386__) || defined(__x86_64__)
+#include <x86intrin.h>
+#endif
+
+namespace trace
+{
+    struct Event
+    {
+        const char* name;
+        const char* argName;
+        int64_t arg;
+        uint64_t begin;
+        uint64_t end;
+    };
+
+    //! Events of a single thread. Only the owning thread writes, older events get overwritten.
+    struct ThreadBuffer
+    {
+        static const size_t c_capacity = 1 << 16;
+
+        std::vector<Event> events;
+        uint64_t written;
+        std::string name;
+        int id;
+
+        explicit ThreadBuffer(int id)
+            : events(c_capacity)
+            , written(0)
+            , name("thread " + std::to_string(id))
+            , id(id)
+        {}
+
+        void push(const Event& e)
+        {
+            events[written++ % c_capacity] = e;
+        }
+    };
+
+    //! Raw timestamp: TSC where available, nanoseconds otherwise.
+    inline uint64_t now()
+    {
+#if defined(_MSC_VER) || defined(__i386__) || defined(__x86_64__)
+        return __rdtsc();
+#else
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+    }
+
+    struct State
+    {
+        bool enabled;
+        std::mutex mutex;
+        std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+        // for converting timestamps to microseconds
+        uint64_t enableTimestamp;
+        std::chrono::steady_clock::time_point enableTime;
+
+        State()
+            : enabled(false)
+            , enableTimestamp(0)
+        {}
+    };
+
+    inline State& getState()
+    {
+        static State s_state;
+        return s_state;
+    }
+
+    //! Buffer of the calling thread; created on the first use and kept alive after the thread exits.
+    inline ThreadBuffer& getThreadBuffer()
+    {
+        static thread_local ThreadBuffer* s_buffer = nullptr;
+        if (!s_buffer)
+        {
+            auto& state = getState();
+            std::lock_guard<std::mutex> lock(state.mutex);
+            state.buffers.emplace_back(new ThreadBuffer(static_cast<int>(state.buffers.size())));
+            s_buffer = state.buffers.back().get();
+        }
+        return *s_buffer;
+    }
+
+    inline bool isEnabled()
+    {
+        return getState().enabled;
+    }
+
+    //! Needs to be called before any other thread starts recording.
+    inline void enable()
+    {
+        auto& state = getState();
+        state.enableTimestamp = now();
+        state.enableTime = std::chrono::steady_clock::now();
+        state.enabled = true;
+    }
+
+    //! Names the calling thread in the timeline.
+    inline void setThreadName(const std::string& name)
+    {
+        if (isEnabled())
+        {
+            getThreadBuffer().name = name;
+        }
+    }
+
+    //! Records an event for the lifetime of the object. Name (and argName) must be string literals.
+    class Scope
+    {
+    public:
+        explicit Scope(const char* name, const char* argName = nullptr, int64_t arg = 0)
+            : m_enabled(isEnabled())
+        {
+            if (m_enabled)
+            {
+                m_event.name = name;
+                m_event.argName = argName;
+                m_event.arg = arg;
+                m_event.begin = now();
+            }
+        }
+
+        ~Scope()
+        {
+            if (m_enabled)
+            {
+                m_event.end = now();
+                getThreadBuffer().push(m_event);
+            }
+        }
+
+    private:
+        bool m_enabled;
+        Event m_event;
+
+        Scope(const Scope&);
+        Scope& operator=(const Scope&);
+    };
+
+    //! Writes all the buffers as trace-event JSON. Traced threads must not be recording at the time.
+    inline bool dump(const char* path)
+    {
+        auto& state = getState();
+        std::lock_guard<std::mutex> lock(state.mutex);
+
+        std::ofstream file(path);
+        if (!file)
+        {
+            return false;
+        }
+
+        // calibrate timestamps
+        auto elapsedUs = std::chrono::duration_cast<std::chrono::duration<double, std::micro>>(std::chrono::steady_clock::now() - state.enableTime).count();
+        auto elapsedTicks = now() - state.enableTimestamp;
+        double usPerTick = elapsedTicks ? elapsedUs / elapsedTicks : 0.0;
+
+        file << "{\"traceEvents\":[\n";
+        file.precision(3);
+        file << std::fixed;
+        bool first = true;
+        for (auto& buffer : state.buffers)
+        {
+            file << (first ? "" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->id << ",\"args\":{\"name\":\"" << buffer->name << "\"}}";
+            first = false;
+
+            uint64_t count = std::min<uint64_t>(buffer->written, uint64_t(ThreadBuffer::c_capacity));
+            for (uint64_t i = buffer->written - count; i < buffer->written; ++i)
+            {
+                auto& e = buffer->events[i % ThreadBuffer::c_capacity];
+                if (e.begin < state.enableTimestamp)
+                {
+                    continue;
+                }
+                file << ",\n{\"name\":\"" << e.name << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->id
+                     << ",\"ts\":" << (e.begin - state.enableTimestamp) * usPerTick
+                     << ",\"dur\":" << (e.end - e.begin) * usPerTick;
+                if (e.argName)
+                {
+                    file << ",\"args\":{\"" << e.argName << "\":" << e.arg << "}";
+                }
+                file << "}";
+            }
+        }
+        file << "\n]}\n";
+        return static_cast<bool>(file);
+    }
+}
+
+#define TRACE_SCOPE_CONCAT_IMPL(a, b) a##b
+#define TRACE_SCOPE_CONCAT(a, b) TRACE_SCOPE_CONCAT_IMPL(a, b)
+//! Traces the enclosing scope.
+#define TRACE_SCOPE(...) ::trace::Scope TRACE_SCOPE_CONCAT(traceScope, __LINE__)(__VA_ARGS__)
@@ -27,4 +27,21 @@ template <typename T>
 inline void load_aligned(T& value, const T* data)
 {
     value = *data;
-}
\ No newline at end of file
+}
+
+//! Stores a packed pixel; there's no difference between aligned and unaligned stores here.
+template <typename T>
+inline void store_pixels(T&& value, typename std::remove_reference<T>::type* target, bool)
+{
+    *target = std::forward<T>(value);
+}
+
+//! Stores the value if count is not 0 (there's only one entry).
+template <typename T>
+inline void store_masked(T&& value, typename std::remove_reference<T>::type* target, size_t count)
+{
+    if (count)
+    {
+        *target = std::forward<T>(value);
+    }
+}
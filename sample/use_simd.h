@@ -35,3 +35,22 @@ inline void load_aligned(Vc::Vector<T>& value, const T* data)
     value.load(data, Vc::Aligned);
 }
 
+//! Stores a batch of packed pixels; target needs to be vector aligned if aligned is set. Define
+//! STREAMING_STORES_ENABLED to bypass caches (pays off for frames much bigger than the last level cache).
+template <typename T>
+inline void store_pixels(const Vc::Vector<T>& value, T* target, bool aligned)
+{
+#ifdef STREAMING_STORES_ENABLED
+    aligned ? value.store(target, Vc::Streaming) : value.store(target, Vc::Unaligned | Vc::Streaming);
+#else
+    aligned ? value.store(target, Vc::Aligned) : value.store(target, Vc::Unaligned);
+#endif
+}
+
+//! Stores first count entries at any, pixel aligned, address; memory past them is not touched.
+template <typename T>
+inline void store_masked(const Vc::Vector<T>& value, T* target, size_t count)
+{
+    value.store(target, Vc::Vector<T>::IndexesFromZero() < Vc::Vector<T>(static_cast<T>(count)), Vc::Unaligned);
+}
+
@@ -0,0 +1,53 @@
+// CxxSwizzle
+// Copyright (c) 2013-2015, Piotr Gwiazdowski <gwiazdorrr+github at gmail.com>
+#pragma once
+
+// a scalar configuration that tracks which uniforms each value has been computed from, so that
+// parts of frames that don't depend on the uniforms that changed can be kept
+
+#include <type_traits>
+#include <swizzle/glsl/scalar_support.h>
+#include <swizzle/glsl/tracking_support.h>
+
+typedef swizzle::glsl::tracking_float float_type;
+typedef float_type::internal_type raw_float_type;
+typedef unsigned uint_type;
+typedef bool bool_type;
+
+const size_t scalar_count = 1;
+const size_t float_entries_align = std::alignment_of<float>::value;
+const size_t uint_entries_align = std::alignment_of<unsigned>::value;
+
+template <typename T>
+inline void store_aligned(T&& value, typename std::remove_reference<T>::type* target)
+{
+    *target = std::forward<T>(value);
+}
+
+template <typename T>
+inline void load_aligned(T& value, const T* data)
+{
+    value = *data;
+}
+
+inline void load_aligned(raw_float_type& value, const float* data)
+{
+    value = *data;
+}
+
+//! Stores a packed pixel; there's no difference between aligned and unaligned stores here.
+template <typename T>
+inline void store_pixels(T&& value, typename std::remove_reference<T>::type* target, bool)
+{
+    *target = std::forward<T>(value);
+}
+
+//! Stores the value if count is not 0 (there's only one entry).
+template <typename T>
+inline void store_masked(T&& value, typename std::remove_reference<T>::type* target, size_t count)
+{
+    if (count)
+    {
+        *target = std::forward<T>(value);
+    }
+}
@@ -0,0 +1,53 @@
+// CxxSwizzle
+// Copyright (c) 2013-2015, Piotr Gwiazdowski <gwiazdorrr+github at gmail.com>
+#include <boost/test/unit_test.hpp>
+#include <algorithm>
+#include "setup.h"
+
+namespace
+{
+#ifndef _MSC_VER
+    // construction from literals happens at compile time
+    constexpr vec3 c_vector(1, 2, 3);
+    constexpr vec4 c_broadcast(5);
+    constexpr vec2 c_zero;
+    constexpr mat2 c_matrix(1.6, -1.2, 1.2, 1.6);
+    constexpr mat3x2 c_rectangular(1, 2, 3, 4, 5, 6);
+
+#if __cplusplus >= 201402L
+    // std::array's const operator[] is constexpr since C++14
+    static_assert(c_vector[0] == 1 && c_vector[1] == 2 && c_vector[2] == 3, "vector literal");
+    static_assert(c_broadcast[0] == 5 && c_broadcast[3] == 5, "vector broadcast");
+    static_assert(c_zero[0] == 0 && c_zero[1] == 0, "vector zero");
+#endif
+#endif
+}
+
+BOOST_AUTO_TEST_SUITE(Constexpr)
+
+BOOST_AUTO_TEST_CASE(vector_literals)
+{
+    const vec3 v(1, 2, 3);
+    BOOST_CHECK(v == vec3(1.0f, 2.0f, 3.0f));
+    BOOST_CHECK(vec4(5) == vec4(5, 5, 5, 5));
+    BOOST_CHECK(vec2() == vec2(0, 0));
+    BOOST_CHECK(vec3(v.zyx) == vec3(3, 2, 1));
+}
+
+BOOST_AUTO_TEST_CASE(matrix_literals)
+{
+    // column-major, like GLSL
+    const mat2 m(1.6, -1.2, 1.2, 1.6);
+    BOOST_CHECK(m[0] == vec2(1.6f, -1.2f));
+    BOOST_CHECK(m[1] == vec2(1.2f, 1.6f));
+
+    const mat3x2 r(1, 2, 3, 4, 5, 6);
+    BOOST_CHECK(r[0] == vec3(1, 2, 3));
+    BOOST_CHECK(r[1] == vec3(4, 5, 6));
+    BOOST_CHECK(r.cell(2, 1) == 6);
+
+    // mixed with vectors it's the regular path
+    BOOST_CHECK(mat2(vec2(1.6f, -1.2f), 1.2f, 1.6f)[1] == m[1]);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
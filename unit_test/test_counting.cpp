@@ -0,0 +1,53 @@
+// CxxSwizzle
+// Copyright (c) 2013-2015, Piotr Gwiazdowski <gwiazdorrr+github at gmail.com>
+
+#include <boost/test/unit_test.hpp>
+#include <swizzle/glsl/vector.h>
+#include <swizzle/glsl/scalar_support.h>
+#include <swizzle/glsl/counting_support.h>
+
+namespace
+{
+    typedef swizzle::glsl::vector<swizzle::glsl::counting_float, 3> cvec3;
+    using swizzle::detail::op_counters;
+
+    namespace counting
+    {
+        #include <swizzle/glsl/vector_functions.h>
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(Counting)
+
+BOOST_AUTO_TEST_CASE(arithmetic)
+{
+    cvec3 a(1, 2, 3);
+    cvec3 b(4, 5, 6);
+
+    auto& counters = op_counters::current();
+    counters.reset();
+
+    cvec3 c = a.zyx + b;
+    BOOST_CHECK_EQUAL(counters.counts[swizzle::detail::op_add], 3u);
+    BOOST_CHECK_EQUAL(static_cast<float>(static_cast<swizzle::glsl::counting_float::internal_type>(c.x)), 7.0f);
+}
+
+BOOST_AUTO_TEST_CASE(functions)
+{
+    cvec3 a(3, 4, 0);
+
+    auto& counters = op_counters::current();
+    counters.reset();
+
+    auto l = counting::length(a);
+    BOOST_CHECK_EQUAL(static_cast<float>(static_cast<swizzle::glsl::counting_float::internal_type>(l)), 5.0f);
+    BOOST_CHECK_EQUAL(counters.counts[swizzle::detail::op_mul], 3u);
+    BOOST_CHECK_EQUAL(counters.counts[swizzle::detail::op_sqrt], 1u);
+    BOOST_CHECK_EQUAL(counters.counts[swizzle::detail::op_sin], 0u);
+
+    counters.reset();
+    counting::sin(a);
+    BOOST_CHECK_EQUAL(counters.counts[swizzle::detail::op_sin], 3u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
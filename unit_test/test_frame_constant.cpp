@@ -0,0 +1,27 @@
+// CxxSwizzle
+// Copyright (c) 2013-2015, Piotr Gwiazdowski <gwiazdorrr+github at gmail.com>
+
+#include <boost/test/unit_test.hpp>
+#include <swizzle/glsl/frame_constant.h>
+
+BOOST_AUTO_TEST_SUITE(FrameConstant)
+
+BOOST_AUTO_TEST_CASE(computed_once_per_generation)
+{
+    using swizzle::glsl::uniform_generation;
+
+    swizzle::glsl::frame_constant<int> constant;
+    int computations = 0;
+    auto compute = [&]() -> int { return ++computations * 10; };
+
+    BOOST_CHECK_EQUAL(constant.get(compute), 10);
+    BOOST_CHECK_EQUAL(constant.get(compute), 10);
+    BOOST_CHECK_EQUAL(computations, 1);
+
+    uniform_generation::next();
+    BOOST_CHECK_EQUAL(constant.get(compute), 20);
+    BOOST_CHECK_EQUAL(constant.get(compute), 20);
+    BOOST_CHECK_EQUAL(computations, 2);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
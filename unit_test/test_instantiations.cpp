@@ -0,0 +1,26 @@
+// CxxSwizzle
+// Copyright (c) 2013-2015, Piotr Gwiazdowski <gwiazdorrr+github at gmail.com>
+#include <boost/test/unit_test.hpp>
+#include "setup.h"
+#include <swizzle/glsl/instantiations.h>
+
+// every member of the common types has to compile, even ones not used anywhere
+CXXSWIZZLE_INSTANTIATE(, float)
+CXXSWIZZLE_INSTANTIATE(, double)
+CXXSWIZZLE_INSTANTIATE(, int)
+
+BOOST_AUTO_TEST_SUITE(Instantiations)
+
+BOOST_AUTO_TEST_CASE(size_dependent_members)
+{
+    // members available only for some sizes are still there
+    vec1 a = 2.0f;
+    float b = a;
+    vec3 c(b);
+    BOOST_CHECK_EQUAL(b, 2.0f);
+    BOOST_CHECK(c == vec3(2, 2, 2));
+    BOOST_CHECK((!std::is_convertible<float, vec3>::value));
+    BOOST_CHECK((!std::is_convertible<vec3, float>::value));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -17,6 +17,16 @@ namespace
 
     void foo(swizzle::detail::vector_inout_wrapper<vec4> a)
     {}
+
+    void increment(swizzle::detail::vector_inout_wrapper<vec2> a)
+    {
+        a += 1.0f;
+    }
+
+    void assign(swizzle::detail::vector_inout_wrapper<vec3> a)
+    {
+        a = vec3(9, 8, 7);
+    }
 }
 
 BOOST_AUTO_TEST_SUITE(Proxies)
@@ -31,5 +41,18 @@ BOOST_AUTO_TEST_CASE(passing)
     foo(v.xzyw);
 }
 
+BOOST_AUTO_TEST_CASE(writing_back)
+{
+    vec4 v(1, 2, 3, 4);
+    increment(v.zx);
+    BOOST_CHECK(v == vec4(2, 2, 4, 4));
+    assign(v.wyx);
+    BOOST_CHECK(v == vec4(7, 8, 4, 9));
+
+    vec3 u(1, 2, 3);
+    increment(u.xy);
+    BOOST_CHECK(u == vec3(2, 3, 3));
+}
+
 
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
@@ -0,0 +1,65 @@
+// CxxSwizzle
+// Copyright (c) 2013-2015, Piotr Gwiazdowski <gwiazdorrr+github at gmail.com>
+#include <boost/test/unit_test.hpp>
+#include "setup.h"
+#include <swizzle/glsl/soa_array.h>
+
+namespace
+{
+    typedef swizzle::glsl::soa_array<vec3> vec3_array;
+
+    vec3_array make_array(size_t size)
+    {
+        vec3_array result(size);
+        for (size_t i = 0; i < size; ++i)
+        {
+            float f = static_cast<float>(i);
+            result.set(i, vec3(f, f * 10, f * 100));
+        }
+        return result;
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(SoaArray)
+
+BOOST_AUTO_TEST_CASE(planes)
+{
+    auto a = make_array(13);
+    BOOST_CHECK_EQUAL(a.size(), 13u);
+    BOOST_CHECK(a.get(7) == vec3(7, 70, 700));
+    for (size_t i = 0; i < 3; ++i)
+    {
+        BOOST_CHECK_EQUAL(reinterpret_cast<uintptr_t>(a.plane(i)) % vec3_array::alignment, 0u);
+    }
+    BOOST_CHECK_EQUAL(a.plane(1)[5], 50.0f);
+    // padding is zero
+    BOOST_CHECK_EQUAL(a.plane(0)[13], 0.0f);
+}
+
+BOOST_AUTO_TEST_CASE(copy_and_resize)
+{
+    auto a = make_array(5);
+    vec3_array b = a;
+    a.set(0, vec3(-1));
+    BOOST_CHECK(b.get(0) == vec3(0));
+
+    b.resize(20);
+    BOOST_CHECK_EQUAL(b.size(), 20u);
+    BOOST_CHECK(b.get(4) == vec3(4, 40, 400));
+    BOOST_CHECK(b.get(19) == vec3(0));
+
+    b.resize(2);
+    BOOST_CHECK(b.get(1) == vec3(1, 10, 100));
+}
+
+BOOST_AUTO_TEST_CASE(batches)
+{
+    auto a = make_array(9);
+    BOOST_CHECK_EQUAL(vec3_array::batch_size<float>(), 1u);
+    BOOST_CHECK(a.load<float>(3) == vec3(3, 30, 300));
+
+    a.transform<float>([](const vec3& v) -> vec3 { return v.zxy * 2.0f; });
+    BOOST_CHECK(a.get(8) == vec3(1600, 16, 160));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
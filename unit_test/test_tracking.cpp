@@ -0,0 +1,75 @@
+// CxxSwizzle
+// Copyright (c) 2013-2015, Piotr Gwiazdowski <gwiazdorrr+github at gmail.com>
+
+#include <boost/test/unit_test.hpp>
+#include <swizzle/glsl/vector.h>
+#include <swizzle/glsl/scalar_support.h>
+#include <swizzle/glsl/tracking_support.h>
+
+namespace
+{
+    typedef swizzle::glsl::tracking_float tfloat;
+    typedef swizzle::glsl::vector<tfloat, 3> tvec3;
+    using swizzle::detail::dependency_tracker;
+
+    namespace tracking
+    {
+        #include <swizzle/glsl/vector_functions.h>
+    }
+
+    unsigned get_dependencies(const tfloat& value)
+    {
+        return static_cast<tfloat::internal_type>(value).dependencies;
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(Tracking)
+
+BOOST_AUTO_TEST_CASE(arithmetic)
+{
+    tfloat a = tfloat::internal_type(2, 1);
+    tfloat b = tfloat::internal_type(3, 2);
+    tvec3 v(a, 1, b);
+
+    BOOST_CHECK_EQUAL(get_dependencies(v.y * 2 + 1), 0u);
+    BOOST_CHECK_EQUAL(get_dependencies(v.x * 2 + 1), 1u);
+    BOOST_CHECK_EQUAL(get_dependencies((v.xy + v.zy).x), 3u);
+
+    tvec3 c = v.zyx * v.y;
+    BOOST_CHECK_EQUAL(get_dependencies(c.x), 2u);
+    BOOST_CHECK_EQUAL(get_dependencies(c.y), 0u);
+    BOOST_CHECK_EQUAL(static_cast<float>(static_cast<tfloat::internal_type>(c.x).value), 3.0f);
+}
+
+BOOST_AUTO_TEST_CASE(functions)
+{
+    tfloat a = tfloat::internal_type(3, 1);
+    tfloat b = tfloat::internal_type(4, 4);
+    tvec3 v(a, b, 0);
+
+    auto l = tracking::length(v);
+    BOOST_CHECK_EQUAL(get_dependencies(l), 5u);
+    BOOST_CHECK_EQUAL(static_cast<tfloat::internal_type>(l).value, 5.0f);
+    BOOST_CHECK_EQUAL(get_dependencies(tracking::sin(v).z), 0u);
+    BOOST_CHECK_EQUAL(get_dependencies(tracking::max(v.x, v.z)), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(control_flow)
+{
+    tfloat a = tfloat::internal_type(2, 1);
+    tfloat b = tfloat::internal_type(3, 2);
+
+    auto& tracker = dependency_tracker::current();
+    tracker.reset();
+
+    // the value doesn't depend on a, but which one got picked does
+    tfloat c = a > 1.0f ? tfloat(1.0f) : tfloat(0.0f);
+    BOOST_CHECK_EQUAL(get_dependencies(c), 0u);
+    BOOST_CHECK_EQUAL(tracker.mask, 1u);
+
+    // so does anything that escapes to raw types
+    static_cast<int>(static_cast<tfloat::internal_type>(b));
+    BOOST_CHECK_EQUAL(tracker.mask, 3u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()